@@ -0,0 +1,186 @@
+/**
+ * @file Allocator相关操作函数的实现
+ * @brief 这个文件实现了容器存储的分配：小块用malloc或posix_memalign，大块和大页用匿名mmap，扩容时用mremap移动页表而不复制数据。
+ */
+#define _GNU_SOURCE // mremap, MAP_HUGETLB
+#include "allocator.h"
+
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/mman.h>
+
+/**
+ * @brief 映射的粒度：使用大页时为ALLOCATOR_HUGE_PAGE_SIZE，否则为系统页大小。
+ */
+static size_t allocator_page(const AllocatorOptions *options)
+{
+    if (options->hugePages != ALLOCATOR_HUGEPAGE_NONE)
+        return ALLOCATOR_HUGE_PAGE_SIZE;
+    static size_t cached = 0;
+    size_t page = __atomic_load_n(&cached, __ATOMIC_RELAXED);
+    if (page == 0)
+    {
+        long size = sysconf(_SC_PAGESIZE);
+        page = size > 0 ? (size_t)size : 4096;
+        __atomic_store_n(&cached, page, __ATOMIC_RELAXED); // 各线程算出的结果相同，重复写入无妨
+    }
+    return page;
+}
+
+/**
+ * @brief bytes字节的存储是否用mmap分配。映射的起始地址按页对齐，对齐要求超过一页时只能用posix_memalign。
+ */
+static bool allocator_mapped(const AllocatorOptions *options, size_t bytes)
+{
+    if (bytes == 0 || options->alignment > allocator_page(options))
+        return false;
+    return options->hugePages != ALLOCATOR_HUGEPAGE_NONE || (options->mapThreshold != 0 && bytes >= options->mapThreshold);
+}
+
+/**
+ * @brief bytes字节的存储实际映射的长度（按映射粒度向上取整）。
+ */
+static size_t allocator_map_length(const AllocatorOptions *options, size_t bytes)
+{
+    size_t page = allocator_page(options);
+    return (bytes + page - 1) / page * page;
+}
+
+/**
+ * @brief 用匿名mmap分配len字节。使用大页时多映射一个大页再裁掉首尾，使起始地址按大页对齐，透明大页才能生效。
+ */
+static void *allocator_map(const AllocatorOptions *options, size_t len)
+{
+    const int prot = PROT_READ | PROT_WRITE, flags = MAP_PRIVATE | MAP_ANONYMOUS;
+    if (options->hugePages == ALLOCATOR_HUGEPAGE_EXPLICIT)
+    {
+        void *p = mmap(NULL, len, prot, flags | MAP_HUGETLB, -1, 0);
+        if (p != MAP_FAILED)
+            return p;
+        // 没有预留的大页，退回透明大页
+    }
+    if (options->hugePages == ALLOCATOR_HUGEPAGE_NONE)
+    {
+        void *p = mmap(NULL, len, prot, flags, -1, 0);
+        return p == MAP_FAILED ? NULL : p;
+    }
+    if (len > SIZE_MAX - ALLOCATOR_HUGE_PAGE_SIZE)
+        return NULL;
+    size_t raw = len + ALLOCATOR_HUGE_PAGE_SIZE;
+    char *p = (char *)mmap(NULL, raw, prot, flags, -1, 0);
+    if (p == MAP_FAILED)
+        return NULL;
+    char *aligned = (char *)(((uintptr_t)p + ALLOCATOR_HUGE_PAGE_SIZE - 1) & ~(uintptr_t)(ALLOCATOR_HUGE_PAGE_SIZE - 1));
+    if (aligned > p)
+        munmap(p, aligned - p);
+    if (aligned + len < p + raw)
+        munmap(aligned + len, p + raw - (aligned + len));
+    madvise(aligned, len, MADV_HUGEPAGE);
+    return aligned;
+}
+
+/**
+ * @brief 在堆上分配bytes字节，对齐要求超过malloc的默认对齐时用posix_memalign。
+ */
+static void *allocator_heap(const AllocatorOptions *options, size_t bytes)
+{
+    if (options->alignment <= _Alignof(max_align_t))
+        return malloc(bytes);
+    void *p = NULL;
+    size_t alignment = options->alignment < sizeof(void *) ? sizeof(void *) : options->alignment;
+    return posix_memalign(&p, alignment, bytes) == 0 ? p : NULL;
+}
+
+/**
+ * @brief 按选项分配bytes字节的存储。
+ *
+ * @param options 分配方式。
+ * @param bytes 字节数，为0时不分配并返回NULL。
+ * @note 选项要求zeroFill时内存内容为0（mmap得到的内存不需要再清零，也就不会在分配时访问每一页）。
+ * @return void* 分配到的内存；失败时返回NULL，由调用的容器输出错误提示信息。
+ */
+void *AllocatorAlloc(const AllocatorOptions *options, size_t bytes)
+{
+    if (bytes == 0)
+        return NULL;
+    void *p;
+    if (allocator_mapped(options, bytes))
+    {
+        p = allocator_map(options, allocator_map_length(options, bytes));
+    }
+    else
+    {
+        p = allocator_heap(options, bytes);
+        if (p != NULL && options->zeroFill)
+            memset(p, 0, bytes);
+    }
+    return p;
+}
+
+/**
+ * @brief 把由AllocatorAlloc（或本函数）得到的存储从oldBytes字节调整为newBytes字节，保留前min(oldBytes, newBytes)字节的内容。
+ *
+ * @param options 分配方式，必须与分配ptr时相同。
+ * @param ptr 原来的存储，可以为NULL（此时oldBytes必须为0）。
+ * @param oldBytes 原来的字节数。
+ * @param newBytes 新的字节数，必须大于0。
+ * @note 新旧存储都是mmap映射时用mremap调整，只改变页表而不复制数据；堆上不要求额外对齐时用realloc；其余情况分配新存储并复制。
+ * @return void* 调整后的存储；失败时返回NULL，原来的存储保持不变。
+ */
+void *AllocatorRealloc(const AllocatorOptions *options, void *ptr, size_t oldBytes, size_t newBytes)
+{
+    if (ptr == NULL || oldBytes == 0)
+        return AllocatorAlloc(options, newBytes);
+    bool oldMapped = allocator_mapped(options, oldBytes), newMapped = allocator_mapped(options, newBytes);
+    void *p = NULL;
+    if (oldMapped && newMapped)
+    {
+        size_t oldLen = allocator_map_length(options, oldBytes), newLen = allocator_map_length(options, newBytes);
+        p = oldLen == newLen ? ptr : mremap(ptr, oldLen, newLen, MREMAP_MAYMOVE);
+        if (p != MAP_FAILED)
+        {
+            // 缩容后留在最后一页中的旧数据要清掉，新映射进来的页本来就是0
+            if (options->zeroFill && newBytes > oldBytes)
+                memset((char *)p + oldBytes, 0, (newBytes < oldLen ? newBytes : oldLen) - oldBytes);
+            return p;
+        }
+        p = NULL; // mremap失败（如显式大页不支持），退回分配加复制
+    }
+    else if (!oldMapped && !newMapped && options->alignment <= _Alignof(max_align_t))
+    {
+        p = realloc(ptr, newBytes);
+        if (p == NULL)
+            return NULL;
+        if (options->zeroFill && newBytes > oldBytes)
+            memset((char *)p + oldBytes, 0, newBytes - oldBytes);
+        return p;
+    }
+    AllocatorOptions noZero = *options;
+    noZero.zeroFill = false;
+    p = AllocatorAlloc(&noZero, newBytes);
+    if (p == NULL)
+        return NULL;
+    memcpy(p, ptr, oldBytes < newBytes ? oldBytes : newBytes);
+    if (options->zeroFill && newBytes > oldBytes && !newMapped)
+        memset((char *)p + oldBytes, 0, newBytes - oldBytes);
+    AllocatorFree(options, ptr, oldBytes);
+    return p;
+}
+
+/**
+ * @brief 释放由AllocatorAlloc或AllocatorRealloc得到的存储。
+ *
+ * @param options 分配方式，必须与分配时相同。
+ * @param ptr 要释放的存储，为NULL时什么也不做。
+ * @param bytes 存储当前的字节数。
+ */
+void AllocatorFree(const AllocatorOptions *options, void *ptr, size_t bytes)
+{
+    if (ptr == NULL)
+        return;
+    if (allocator_mapped(options, bytes))
+        munmap(ptr, allocator_map_length(options, bytes));
+    else
+        free(ptr);
+}
\ No newline at end of file
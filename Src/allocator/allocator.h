@@ -0,0 +1,39 @@
+#ifndef __ALLOCATOR_H__
+#define __ALLOCATOR_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#define ALLOCATOR_HUGE_PAGE_SIZE (2 * 1024 * 1024) // 大页的大小，使用大页时映射长度按它取整
+#define ALLOCATOR_MAP_THRESHOLD (1024 * 1024)      // 推荐的mapThreshold：达到1MiB的存储改用mmap，扩容时用mremap
+
+/// 是否使用大页
+typedef enum AllocatorHugePages
+{
+    ALLOCATOR_HUGEPAGE_NONE,        // 普通页
+    ALLOCATOR_HUGEPAGE_TRANSPARENT, // 按大页对齐映射并madvise(MADV_HUGEPAGE)，由内核的透明大页合并
+    ALLOCATOR_HUGEPAGE_EXPLICIT     // MAP_HUGETLB使用预留的大页，没有可用的大页时退回透明大页
+} AllocatorHugePages;
+
+/**
+ * @brief 容器存储的分配方式。全部字段为0时等价于malloc/realloc/free且不清零。
+ *
+ * 同一块存储从分配到释放必须使用同一组选项，并且每次都传入当时的字节数：
+ * 存储是堆内存还是mmap映射由选项和字节数共同决定，不需要额外记录。
+ */
+typedef struct AllocatorOptions
+{
+    size_t alignment;             // 起始地址的对齐字节数（2的幂，如64），0表示malloc的默认对齐
+    AllocatorHugePages hugePages; // 是否使用大页；使用大页时总是用mmap分配
+    size_t mapThreshold;          // 达到这个字节数的存储用mmap分配、用mremap扩缩容，0表示不使用mmap
+    bool zeroFill;                // 新分配的内存（包括扩容新增的部分）是否清零；mmap得到的内存本来就是0，不需要再写
+} AllocatorOptions;
+
+void *AllocatorAlloc(const AllocatorOptions *options, size_t bytes);
+
+void *AllocatorRealloc(const AllocatorOptions *options, void *ptr, size_t oldBytes, size_t newBytes);
+
+void AllocatorFree(const AllocatorOptions *options, void *ptr, size_t bytes);
+
+#endif
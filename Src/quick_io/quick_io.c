@@ -1,137 +1,2579 @@
 #include "quick_io.h"
 
 #include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include <stdbool.h>
 #include <math.h>
+#include <float.h>
 #include <ctype.h>
+#include <errno.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/uio.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <pthread.h>
 
-const double dten[10] = {0, 1e-1, 1e-2, 1e-3, 1e-4, 1e-5, 1e-6, 1e-7, 1e-8, 1e-9};
-/// 一般题目至多要求输出小数点后6位，此数组足矣。
+#include "../ringbuffer/ringbuffer.h"
 
-char outputbuf[15]; /// 声明成全局变量可以减小开销
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define QIO_X86_SIMD // 批量读取使用SSE4.1/AVX2内核，运行时按CPU选择
+#include <immintrin.h>
+#endif
 
-/// @brief 读整数
+/// 默认的stdio流，旧的QIOxxx接口都是它的包装
+static QIOStream qio_stdio = {
+    {NULL, NULL, NULL, QIO_DEFAULT_BUFFER_SIZE, NULL, 0, STDIN_FILENO, false, false, false, false, false, NULL},
+    {NULL, NULL, NULL, NULL, QIO_DEFAULT_BUFFER_SIZE, STDOUT_FILENO, 0, {{NULL, 0}}}};
+
+/// @brief 尝试把fd对应的普通文件从当前读写位置开始映射为输入
+/// @return 映射成功返回true；fd不是普通文件、文件为空或mmap失败时返回false
+static bool qio_map_fd(QIOStream *this, int fd)
+{
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode) || st.st_size <= 0)
+        return false;
+    off_t off = lseek(fd, 0, SEEK_CUR);
+    if (off < 0 || off >= st.st_size)
+        return false;
+    void *map = mmap(NULL, st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == MAP_FAILED)
+        return false;
+    madvise(map, st.st_size, MADV_SEQUENTIAL);
+    this->in.map = (char *)map;
+    this->in.mapLen = st.st_size;
+    this->in.cur = this->in.map + off;
+    this->in.end = this->in.map + st.st_size;
+    this->in.eof = true; // 整个文件都已经可见，不需要再填充
+    return true;
+}
+
+/// 预读线程每次read()的最大字节数
+#define QIO_READAHEAD_CHUNK (1 << 16)
+
+/// 预读：后台线程不断从fd读数据写进环形缓冲区，解析线程从环形缓冲区取数据，磁盘/管道的等待与解析重叠
+typedef struct QIOReadAhead
+{
+    RingBuffer ring;         ///< 预读到的数据，由lock保护；优先使用镜像模式，read()直接写进环形缓冲区
+    pthread_t thread;        ///< 预读线程
+    pthread_mutex_t lock;    ///< 保护ring、eof和stop
+    pthread_cond_t notEmpty; ///< 环形缓冲区有了新数据或预读线程结束
+    pthread_cond_t notFull;  ///< 环形缓冲区腾出了空间或要求预读线程退出
+    int fd;                  ///< 数据来源的文件描述符
+    bool eof;                ///< 预读线程已经读到EOF（或出错），不会再写入新数据
+    bool stop;               ///< 要求预读线程退出
+} QIOReadAhead;
+
+/// @brief 预读线程：在锁内预留环形缓冲区的空闲区域，在锁外直接read()进去，再在锁内提交
+/// @note read()阻塞时允许被取消，其余时间只在stop被设置时退出，因此取消时不会持有锁；
+///       消费者只会读取已提交的数据，预留区域在锁外写入是安全的
+static void *qio_readahead_main(void *arg)
+{
+    QIOReadAhead *ra = (QIOReadAhead *)arg;
+    pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
+    for (;;)
+    {
+        pthread_mutex_lock(&ra->lock);
+        while (!ra->stop && RingBufferIsFull(&ra->ring))
+            pthread_cond_wait(&ra->notFull, &ra->lock);
+        if (ra->stop)
+        {
+            pthread_mutex_unlock(&ra->lock);
+            return NULL;
+        }
+        size_t len = ra->ring.capacity - RingBufferSize(&ra->ring);
+        if (len > QIO_READAHEAD_CHUNK)
+            len = QIO_READAHEAD_CHUNK;
+        uint8_t *dst;
+        while ((dst = RingBufferWriteReserve(&ra->ring, len)) == NULL)
+            len /= 2; // 非镜像模式下连续的空闲区域在缓冲区末尾被截断
+        pthread_mutex_unlock(&ra->lock);
+
+        ssize_t n;
+        pthread_setcancelstate(PTHREAD_CANCEL_ENABLE, NULL);
+        do
+            n = read(ra->fd, dst, len);
+        while (n < 0 && errno == EINTR);
+        pthread_setcancelstate(PTHREAD_CANCEL_DISABLE, NULL);
+
+        pthread_mutex_lock(&ra->lock);
+        if (n <= 0)
+            ra->eof = true;
+        else
+            RingBufferWriteCommit(&ra->ring, n);
+        pthread_cond_signal(&ra->notEmpty);
+        pthread_mutex_unlock(&ra->lock);
+        if (n <= 0)
+            return NULL;
+    }
+}
+
+/// @brief 从预读的环形缓冲区取最多len字节，没有数据时等待预读线程
+/// @return 取到的字节数，0表示预读线程已经读到EOF并且数据都已取完
+static size_t qio_readahead_read(QIOReadAhead *ra, char *dst, size_t len)
+{
+    pthread_mutex_lock(&ra->lock);
+    while (RingBufferIsEmpty(&ra->ring) && !ra->eof)
+        pthread_cond_wait(&ra->notEmpty, &ra->lock);
+    size_t n = RingBufferReadData(&ra->ring, (uint8_t *)dst, len);
+    if (n > 0)
+        pthread_cond_signal(&ra->notFull);
+    pthread_mutex_unlock(&ra->lock);
+    return n;
+}
+
+/// @brief 停止预读线程并释放环形缓冲区；线程可能阻塞在read()上，因此先设置stop再取消它
+static void qio_readahead_stop(QIOStream *this)
+{
+    QIOReadAhead *ra = this->in.ahead;
+    if (ra == NULL)
+        return;
+    pthread_mutex_lock(&ra->lock);
+    ra->stop = true;
+    pthread_cond_signal(&ra->notFull);
+    pthread_mutex_unlock(&ra->lock);
+    pthread_cancel(ra->thread);
+    pthread_join(ra->thread, NULL);
+    pthread_cond_destroy(&ra->notEmpty);
+    pthread_cond_destroy(&ra->notFull);
+    pthread_mutex_destroy(&ra->lock);
+    RingBufferClear(&ra->ring);
+    free(ra);
+    this->in.ahead = NULL;
+}
+
+/// @brief 从输入的文件描述符读数据，开启预读时改为从环形缓冲区取
+/// @return 读到的字节数，0表示EOF，负数表示出错
+static ssize_t qio_read_input(QIOStream *this, char *dst, size_t len)
+{
+    if (this->in.ahead != NULL)
+        return qio_readahead_read(this->in.ahead, dst, len);
+    ssize_t n;
+    do
+        n = read(this->in.fd, dst, len);
+    while (n < 0 && errno == EINTR);
+    return n;
+}
+
+/// @brief 解除当前的映射并关闭由QuickIO打开的文件
+static void qio_close_input(QIOStream *this)
+{
+    qio_readahead_stop(this);
+    if (this->in.map != NULL)
+    {
+        munmap(this->in.map, this->in.mapLen);
+        this->in.map = NULL;
+        this->in.mapLen = 0;
+    }
+    if (this->in.ownfd)
+    {
+        close(this->in.fd);
+        this->in.ownfd = false;
+    }
+    this->in.cur = this->in.end = this->in.buf;
+    this->in.eof = false;
+    this->in.borrowed = false;
+}
+
+/// @brief 分配流式读取用的缓冲区
+static bool qio_alloc_input(QIOStream *this)
+{
+    if (this->in.buf != NULL)
+        return true;
+    this->in.buf = (char *)malloc(this->in.size);
+    if (this->in.buf == NULL)
+    {
+        fprintf(stderr, "Memory allocation failed for QuickIO input buffer.\n");
+        return false;
+    }
+    this->in.cur = this->in.end = this->in.buf;
+    return true;
+}
+
+/// @brief 初始化流的输入：普通文件直接mmap（定义QIO_DISABLE_MMAP可关闭），否则分配流式读取的缓冲区
+/// @return 成功返回true；缓冲区分配失败时返回false，默认stdio流退化为getchar()，其他流之后的读取都返回EOF
+static bool qio_input_init(QIOStream *this)
+{
+    if (this->in.inited)
+        return !this->in.fallback;
+    this->in.inited = true;
+    if (this->in.fd < 0)
+    {
+        this->in.eof = true;
+        return true;
+    }
+#ifndef QIO_DISABLE_MMAP
+    if (qio_map_fd(this, this->in.fd))
+        return true;
+#endif
+    if (!qio_alloc_input(this))
+    {
+        if (this == &qio_stdio)
+            this->in.fallback = true;
+        else
+            this->in.eof = true;
+        return false;
+    }
+    return true;
+}
+
+/// @brief 初始化QuickIO的输入，不调用时会在第一次读取时自动初始化
+/// @note stdin是普通文件时直接mmap（定义QIO_DISABLE_MMAP可关闭），否则用缓冲区流式读取。
+///       QuickIO会一次性从stdin的文件描述符预读一大块数据，因此不要与scanf/getchar等stdio读函数混用
+/// @return 初始化成功返回true，缓冲区分配失败时退化为getchar()逐字节读取并返回false
+bool QIOInit(void)
+{
+    return qio_input_init(&qio_stdio);
+}
+
+/// @brief 改为从path指定的文件读取输入
+/// @param this 指向目标流的指针
+/// @param path 文件路径
+/// @note 普通文件会被mmap（并设置MADV_SEQUENTIAL）后直接在映射区上解析；管道、FIFO等无法映射的文件退回流式读取。
+///       之前的输入中尚未读取的数据会被丢弃
+/// @return 成功返回true，文件打不开或缓冲区分配失败返回false
+bool QIOStreamOpenMapped(QIOStream *this, const char *path)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        fprintf(stderr, "QuickIO failed to open %s.\n", path);
+        return false;
+    }
+    qio_close_input(this);
+    this->in.inited = true;
+    this->in.fallback = false;
+    this->in.fd = fd;
+    this->in.ownfd = true;
+    if (qio_map_fd(this, fd))
+        return true;
+    if (!qio_alloc_input(this))
+    {
+        qio_close_input(this);
+        this->in.eof = true;
+        return false;
+    }
+    return true;
+}
+
+/// @brief 改为从调用者提供的一段内存中读取输入
+/// @param this 指向目标流的指针
+/// @param data 数据起始地址，在流读完或改换输入之前必须保持有效
+/// @param len 数据长度（字节）
+/// @note 直接在data上解析，不复制也不分配缓冲区，读到data+len即为EOF；适合把一个大文件切块后交给多个流并行解析。
+///       之前的输入中尚未读取的数据会被丢弃
+void QIOStreamOpenMemory(QIOStream *this, const char *data, size_t len)
+{
+    qio_close_input(this);
+    this->in.inited = true;
+    this->in.fallback = false;
+    this->in.borrowed = true;
+    this->in.cur = (char *)data;
+    this->in.end = (char *)data + len;
+    this->in.eof = true;
+}
+
+/// @brief 开启预读：后台线程不断从输入的文件描述符读数据写进环形缓冲区，解析时从环形缓冲区取数据
+/// @param this 指向目标流的指针
+/// @param ringSize 环形缓冲区的容量（字节），会向上取整为2的幂，为0时使用默认值QIO_DEFAULT_READAHEAD_SIZE
+/// @note 适合输入来自慢速管道（例如解压程序）的情况，读取的等待与解析重叠；输入已被映射或来自内存时无需预读，直接返回true。
+///       预读线程读到EOF后自行退出，流被删除或改换输入时会停止尚未退出的预读线程
+/// @return 成功返回true；已经开启预读时返回true，内存分配或线程创建失败时返回false，此时流照常同步读取
+bool QIOStreamEnableReadAhead(QIOStream *this, size_t ringSize)
+{
+    if (!qio_input_init(this))
+        return false;
+    if (this->in.ahead != NULL || this->in.map != NULL || this->in.borrowed || this->in.eof)
+        return true;
+    if (ringSize == 0)
+        ringSize = QIO_DEFAULT_READAHEAD_SIZE;
+    QIOReadAhead *ra = (QIOReadAhead *)malloc(sizeof(QIOReadAhead));
+    if (ra == NULL)
+    {
+        fprintf(stderr, "Memory allocation failed for QuickIO read-ahead.\n");
+        return false;
+    }
+    ra->ring = RingBufferCreateMirrored(ringSize);
+    if (ra->ring.buffer == NULL)
+        ra->ring = RingBufferCreatePow2(ringSize);
+    if (ra->ring.buffer == NULL)
+    {
+        free(ra);
+        return false;
+    }
+    ra->fd = this->in.fd;
+    ra->eof = false;
+    ra->stop = false;
+    pthread_mutex_init(&ra->lock, NULL);
+    pthread_cond_init(&ra->notEmpty, NULL);
+    pthread_cond_init(&ra->notFull, NULL);
+    if (pthread_create(&ra->thread, NULL, qio_readahead_main, ra) != 0)
+    {
+        fprintf(stderr, "QuickIO failed to start the read-ahead thread.\n");
+        pthread_cond_destroy(&ra->notEmpty);
+        pthread_cond_destroy(&ra->notFull);
+        pthread_mutex_destroy(&ra->lock);
+        RingBufferClear(&ra->ring);
+        free(ra);
+        return false;
+    }
+    this->in.ahead = ra;
+    return true;
+}
+
+/// @brief 设置输入缓冲区的大小
+/// @param this 指向目标流的指针
+/// @param size 新的缓冲区容量（字节），为0时使用默认值QIO_DEFAULT_BUFFER_SIZE
+/// @note 可以在读取过程中调用，缓冲区中尚未读取的数据会被保留；映射模式和内存输入下只记录大小
+/// @return 成功返回true；若内存分配失败或新容量放不下尚未读取的数据，保持原缓冲区不变并返回false
+bool QIOStreamSetBufferSize(QIOStream *this, size_t size)
+{
+    if (size == 0)
+        size = QIO_DEFAULT_BUFFER_SIZE;
+    if (this->in.buf == NULL || this->in.map != NULL || this->in.borrowed)
+    {
+        free(this->in.buf); // 映射模式和内存输入下缓冲区闲置，之后需要流式读取时再按新大小分配
+        this->in.buf = NULL;
+        this->in.size = size;
+        return true;
+    }
+    size_t pending = this->in.end - this->in.cur;
+    if (pending > size)
+        return false;
+    char *buf = (char *)malloc(size);
+    if (buf == NULL)
+    {
+        fprintf(stderr, "Memory allocation failed for QuickIO input buffer.\n");
+        return false;
+    }
+    memcpy(buf, this->in.cur, pending);
+    free(this->in.buf);
+    this->in.buf = this->in.cur = buf;
+    this->in.end = buf + pending;
+    this->in.size = size;
+    return true;
+}
+
+/// @brief 缓冲区读空后重新填充并返回下一个字节
+/// @return 下一个字节，读到文件末尾返回EOF
+static int qio_refill(QIOStream *this)
+{
+    if (!this->in.inited)
+    {
+        qio_input_init(this);
+        if (this->in.cur < this->in.end) // 输入被映射后数据已经就绪
+            return (unsigned char)*this->in.cur++;
+    }
+    if (this->in.fallback)
+        return getchar();
+    if (this->in.eof)
+        return EOF;
+    ssize_t n = qio_read_input(this, this->in.buf, this->in.size);
+    if (n <= 0)
+    {
+        this->in.eof = true;
+        this->in.cur = this->in.end = this->in.buf;
+        return EOF;
+    }
+    this->in.cur = this->in.buf + 1;
+    this->in.end = this->in.buf + n;
+    return (unsigned char)this->in.buf[0];
+}
+
+/// @brief 从输入缓冲区取一个字节
+static inline int qio_getc(QIOStream *this)
+{
+    if (this->in.cur < this->in.end)
+        return (unsigned char)*this->in.cur++;
+    return qio_refill(this);
+}
+
+/// 比isdigit()少一次查表，且对EOF等负值同样安全
+#define QIO_IS_DIGIT(c) ((unsigned)((c) - '0') < 10u)
+
+/// @brief 整数解析的公共部分：跳过分隔符，读出符号
+/// @param first 存放符号之后的第一个字符（没有数字时为其后的字符或EOF）
+/// @param neg 存放是否带负号
+/// @return 若找到一个整数的开头返回true，若读到EOF返回false
+static inline bool qio_scan_sign(QIOStream *this, int *first, bool *neg)
+{
+    int c;
+    while ((c = qio_getc(this)) != '-' && !QIO_IS_DIGIT(c))
+        if (c == EOF)
+            return false;
+    if ((*neg = c == '-'))
+        c = qio_getc(this);
+    *first = c;
+    return true;
+}
+
+/// @brief 整数解析核心：跳过分隔符，读出符号和绝对值
+/// @param mag 存放绝对值，超出64位时回绕
+/// @param neg 存放是否带负号
+/// @return 若成功读到一个整数返回true，若读到EOF返回false
+static inline bool qio_scan_integer(QIOStream *this, uint64_t *mag, bool *neg)
+{
+    int c;
+    if (!qio_scan_sign(this, &c, neg))
+        return false;
+    uint64_t v = 0;
+    for (; QIO_IS_DIGIT(c); c = qio_getc(this))
+        v = v * 10 + (c & 15);
+    *mag = v;
+    return true;
+}
+
+#ifdef __SIZEOF_INT128__
+/// @brief 128位整数的解析核心，用法同qio_scan_integer，绝对值超出128位时回绕
+/// @note 绝对值按19位一组在64位整数中累加，超过19位时才做128位的合并
+static inline bool qio_scan_integer128(QIOStream *this, QIOUInt128 *mag, bool *neg)
+{
+    int c;
+    if (!qio_scan_sign(this, &c, neg))
+        return false;
+    static const uint64_t chunkscale = 10000000000000000000ULL; // 10^19
+    QIOUInt128 acc = 0;
+    uint64_t chunk = 0, scale = 1;
+    bool wide = false;
+    for (; QIO_IS_DIGIT(c); c = qio_getc(this))
+    {
+        if (scale == chunkscale)
+        {
+            acc = acc * chunkscale + chunk;
+            chunk = 0, scale = 1;
+            wide = true;
+        }
+        chunk = chunk * 10 + (c & 15);
+        scale *= 10;
+    }
+    *mag = wide ? acc * scale + chunk : chunk;
+    return true;
+}
+#endif
+
+/// @brief 定义一个整数读函数
+/// @param NAME 函数名
+/// @param T 结果类型
+/// @param UT 与T等宽的无符号类型，取负在其上进行，因此最小值不会溢出
+/// @param MT 解析核心给出的绝对值类型
+/// @param SCAN 解析核心
+#define QIO_DEFINE_GET_INTEGER(NAME, T, UT, MT, SCAN) \
+    bool NAME(QIOStream *this, T *x)                  \
+    {                                                 \
+        MT mag;                                       \
+        bool neg;                                     \
+        if (!SCAN(this, &mag, &neg))                  \
+            return false;                             \
+        UT u = (UT)mag;                               \
+        *x = (T)(neg ? (UT)0 - u : u);                \
+        return true;                                  \
+    }
+
+/// @brief 从流中读整数
+/// @param this 指向目标流的指针
 /// @param x 存放读取的值
 /// @note -0的输出为0
 /// @return 若成功读到一个整数返回true，若读到EOF返回false
-bool QIOGetInt(int *x)
+QIO_DEFINE_GET_INTEGER(QIOStreamGetInt, int, unsigned, uint64_t, qio_scan_integer)
+
+/// @brief 从流中读64位整数，用法同QIOStreamGetInt
+QIO_DEFINE_GET_INTEGER(QIOStreamGetI64, int64_t, uint64_t, uint64_t, qio_scan_integer)
+
+/// @brief 从流中读64位无符号整数，用法同QIOStreamGetInt（带负号时与strtoull一样按模2^64取负）
+QIO_DEFINE_GET_INTEGER(QIOStreamGetU64, uint64_t, uint64_t, uint64_t, qio_scan_integer)
+
+#ifdef __SIZEOF_INT128__
+/// @brief 从流中读128位整数，用法同QIOStreamGetInt
+QIO_DEFINE_GET_INTEGER(QIOStreamGetI128, QIOInt128, QIOUInt128, QIOUInt128, qio_scan_integer128)
+
+/// @brief 从流中读128位无符号整数，用法同QIOStreamGetU64
+QIO_DEFINE_GET_INTEGER(QIOStreamGetU128, QIOUInt128, QIOUInt128, QIOUInt128, qio_scan_integer128)
+#endif
+
+/// 10的0~22次幂都能被double精确表示，是快速路径的乘数
+static const double exactpow10[23] = {1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9, 1e10, 1e11,
+                                      1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22};
+
+/// 决定double舍入所需的有效数字最多为767位，多出的部分只需要记住是否非零
+#define QIO_MAX_DIGITS 768
+
+#define QIO_POW5_MIN (-342) // 更小的10的幂乘以19位以内的尾数都舍入为0
+#define QIO_POW5_MAX 308    // 更大的10的幂乘以非零尾数都溢出为无穷大
+
+/// 5^q的128位规格化值（最高位为1），q从QIO_POW5_MIN到QIO_POW5_MAX：正幂截断，负幂为倒数向上取整，每项为{高64位, 低64位}
+static const uint64_t pow5x128[][2] = {
+    {0xEEF453D6923BD65AULL, 0x113FAA2906A13B3FULL}, // 5^-342
+    {0x9558B4661B6565F8ULL, 0x4AC7CA59A424C507ULL}, // 5^-341
+    {0xBAAEE17FA23EBF76ULL, 0x5D79BCF00D2DF649ULL}, // 5^-340
+    {0xE95A99DF8ACE6F53ULL, 0xF4D82C2C107973DCULL}, // 5^-339
+    {0x91D8A02BB6C10594ULL, 0x79071B9B8A4BE869ULL}, // 5^-338
+    {0xB64EC836A47146F9ULL, 0x9748E2826CDEE284ULL}, // 5^-337
+    {0xE3E27A444D8D98B7ULL, 0xFD1B1B2308169B25ULL}, // 5^-336
+    {0x8E6D8C6AB0787F72ULL, 0xFE30F0F5E50E20F7ULL}, // 5^-335
+    {0xB208EF855C969F4FULL, 0xBDBD2D335E51A935ULL}, // 5^-334
+    {0xDE8B2B66B3BC4723ULL, 0xAD2C788035E61382ULL}, // 5^-333
+    {0x8B16FB203055AC76ULL, 0x4C3BCB5021AFCC31ULL}, // 5^-332
+    {0xADDCB9E83C6B1793ULL, 0xDF4ABE242A1BBF3DULL}, // 5^-331
+    {0xD953E8624B85DD78ULL, 0xD71D6DAD34A2AF0DULL}, // 5^-330
+    {0x87D4713D6F33AA6BULL, 0x8672648C40E5AD68ULL}, // 5^-329
+    {0xA9C98D8CCB009506ULL, 0x680EFDAF511F18C2ULL}, // 5^-328
+    {0xD43BF0EFFDC0BA48ULL, 0x0212BD1B2566DEF2ULL}, // 5^-327
+    {0x84A57695FE98746DULL, 0x014BB630F7604B57ULL}, // 5^-326
+    {0xA5CED43B7E3E9188ULL, 0x419EA3BD35385E2DULL}, // 5^-325
+    {0xCF42894A5DCE35EAULL, 0x52064CAC828675B9ULL}, // 5^-324
+    {0x818995CE7AA0E1B2ULL, 0x7343EFEBD1940993ULL}, // 5^-323
+    {0xA1EBFB4219491A1FULL, 0x1014EBE6C5F90BF8ULL}, // 5^-322
+    {0xCA66FA129F9B60A6ULL, 0xD41A26E077774EF6ULL}, // 5^-321
+    {0xFD00B897478238D0ULL, 0x8920B098955522B4ULL}, // 5^-320
+    {0x9E20735E8CB16382ULL, 0x55B46E5F5D5535B0ULL}, // 5^-319
+    {0xC5A890362FDDBC62ULL, 0xEB2189F734AA831DULL}, // 5^-318
+    {0xF712B443BBD52B7BULL, 0xA5E9EC7501D523E4ULL}, // 5^-317
+    {0x9A6BB0AA55653B2DULL, 0x47B233C92125366EULL}, // 5^-316
+    {0xC1069CD4EABE89F8ULL, 0x999EC0BB696E840AULL}, // 5^-315
+    {0xF148440A256E2C76ULL, 0xC00670EA43CA250DULL}, // 5^-314
+    {0x96CD2A865764DBCAULL, 0x380406926A5E5728ULL}, // 5^-313
+    {0xBC807527ED3E12BCULL, 0xC605083704F5ECF2ULL}, // 5^-312
+    {0xEBA09271E88D976BULL, 0xF7864A44C633682EULL}, // 5^-311
+    {0x93445B8731587EA3ULL, 0x7AB3EE6AFBE0211DULL}, // 5^-310
+    {0xB8157268FDAE9E4CULL, 0x5960EA05BAD82964ULL}, // 5^-309
+    {0xE61ACF033D1A45DFULL, 0x6FB92487298E33BDULL}, // 5^-308
+    {0x8FD0C16206306BABULL, 0xA5D3B6D479F8E056ULL}, // 5^-307
+    {0xB3C4F1BA87BC8696ULL, 0x8F48A4899877186CULL}, // 5^-306
+    {0xE0B62E2929ABA83CULL, 0x331ACDABFE94DE87ULL}, // 5^-305
+    {0x8C71DCD9BA0B4925ULL, 0x9FF0C08B7F1D0B14ULL}, // 5^-304
+    {0xAF8E5410288E1B6FULL, 0x07ECF0AE5EE44DD9ULL}, // 5^-303
+    {0xDB71E91432B1A24AULL, 0xC9E82CD9F69D6150ULL}, // 5^-302
+    {0x892731AC9FAF056EULL, 0xBE311C083A225CD2ULL}, // 5^-301
+    {0xAB70FE17C79AC6CAULL, 0x6DBD630A48AAF406ULL}, // 5^-300
+    {0xD64D3D9DB981787DULL, 0x092CBBCCDAD5B108ULL}, // 5^-299
+    {0x85F0468293F0EB4EULL, 0x25BBF56008C58EA5ULL}, // 5^-298
+    {0xA76C582338ED2621ULL, 0xAF2AF2B80AF6F24EULL}, // 5^-297
+    {0xD1476E2C07286FAAULL, 0x1AF5AF660DB4AEE1ULL}, // 5^-296
+    {0x82CCA4DB847945CAULL, 0x50D98D9FC890ED4DULL}, // 5^-295
+    {0xA37FCE126597973CULL, 0xE50FF107BAB528A0ULL}, // 5^-294
+    {0xCC5FC196FEFD7D0CULL, 0x1E53ED49A96272C8ULL}, // 5^-293
+    {0xFF77B1FCBEBCDC4FULL, 0x25E8E89C13BB0F7AULL}, // 5^-292
+    {0x9FAACF3DF73609B1ULL, 0x77B191618C54E9ACULL}, // 5^-291
+    {0xC795830D75038C1DULL, 0xD59DF5B9EF6A2417ULL}, // 5^-290
+    {0xF97AE3D0D2446F25ULL, 0x4B0573286B44AD1DULL}, // 5^-289
+    {0x9BECCE62836AC577ULL, 0x4EE367F9430AEC32ULL}, // 5^-288
+    {0xC2E801FB244576D5ULL, 0x229C41F793CDA73FULL}, // 5^-287
+    {0xF3A20279ED56D48AULL, 0x6B43527578C1110FULL}, // 5^-286
+    {0x9845418C345644D6ULL, 0x830A13896B78AAA9ULL}, // 5^-285
+    {0xBE5691EF416BD60CULL, 0x23CC986BC656D553ULL}, // 5^-284
+    {0xEDEC366B11C6CB8FULL, 0x2CBFBE86B7EC8AA8ULL}, // 5^-283
+    {0x94B3A202EB1C3F39ULL, 0x7BF7D71432F3D6A9ULL}, // 5^-282
+    {0xB9E08A83A5E34F07ULL, 0xDAF5CCD93FB0CC53ULL}, // 5^-281
+    {0xE858AD248F5C22C9ULL, 0xD1B3400F8F9CFF68ULL}, // 5^-280
+    {0x91376C36D99995BEULL, 0x23100809B9C21FA1ULL}, // 5^-279
+    {0xB58547448FFFFB2DULL, 0xABD40A0C2832A78AULL}, // 5^-278
+    {0xE2E69915B3FFF9F9ULL, 0x16C90C8F323F516CULL}, // 5^-277
+    {0x8DD01FAD907FFC3BULL, 0xAE3DA7D97F6792E3ULL}, // 5^-276
+    {0xB1442798F49FFB4AULL, 0x99CD11CFDF41779CULL}, // 5^-275
+    {0xDD95317F31C7FA1DULL, 0x40405643D711D583ULL}, // 5^-274
+    {0x8A7D3EEF7F1CFC52ULL, 0x482835EA666B2572ULL}, // 5^-273
+    {0xAD1C8EAB5EE43B66ULL, 0xDA3243650005EECFULL}, // 5^-272
+    {0xD863B256369D4A40ULL, 0x90BED43E40076A82ULL}, // 5^-271
+    {0x873E4F75E2224E68ULL, 0x5A7744A6E804A291ULL}, // 5^-270
+    {0xA90DE3535AAAE202ULL, 0x711515D0A205CB36ULL}, // 5^-269
+    {0xD3515C2831559A83ULL, 0x0D5A5B44CA873E03ULL}, // 5^-268
+    {0x8412D9991ED58091ULL, 0xE858790AFE9486C2ULL}, // 5^-267
+    {0xA5178FFF668AE0B6ULL, 0x626E974DBE39A872ULL}, // 5^-266
+    {0xCE5D73FF402D98E3ULL, 0xFB0A3D212DC8128FULL}, // 5^-265
+    {0x80FA687F881C7F8EULL, 0x7CE66634BC9D0B99ULL}, // 5^-264
+    {0xA139029F6A239F72ULL, 0x1C1FFFC1EBC44E80ULL}, // 5^-263
+    {0xC987434744AC874EULL, 0xA327FFB266B56220ULL}, // 5^-262
+    {0xFBE9141915D7A922ULL, 0x4BF1FF9F0062BAA8ULL}, // 5^-261
+    {0x9D71AC8FADA6C9B5ULL, 0x6F773FC3603DB4A9ULL}, // 5^-260
+    {0xC4CE17B399107C22ULL, 0xCB550FB4384D21D3ULL}, // 5^-259
+    {0xF6019DA07F549B2BULL, 0x7E2A53A146606A48ULL}, // 5^-258
+    {0x99C102844F94E0FBULL, 0x2EDA7444CBFC426DULL}, // 5^-257
+    {0xC0314325637A1939ULL, 0xFA911155FEFB5308ULL}, // 5^-256
+    {0xF03D93EEBC589F88ULL, 0x793555AB7EBA27CAULL}, // 5^-255
+    {0x96267C7535B763B5ULL, 0x4BC1558B2F3458DEULL}, // 5^-254
+    {0xBBB01B9283253CA2ULL, 0x9EB1AAEDFB016F16ULL}, // 5^-253
+    {0xEA9C227723EE8BCBULL, 0x465E15A979C1CADCULL}, // 5^-252
+    {0x92A1958A7675175FULL, 0x0BFACD89EC191EC9ULL}, // 5^-251
+    {0xB749FAED14125D36ULL, 0xCEF980EC671F667BULL}, // 5^-250
+    {0xE51C79A85916F484ULL, 0x82B7E12780E7401AULL}, // 5^-249
+    {0x8F31CC0937AE58D2ULL, 0xD1B2ECB8B0908810ULL}, // 5^-248
+    {0xB2FE3F0B8599EF07ULL, 0x861FA7E6DCB4AA15ULL}, // 5^-247
+    {0xDFBDCECE67006AC9ULL, 0x67A791E093E1D49AULL}, // 5^-246
+    {0x8BD6A141006042BDULL, 0xE0C8BB2C5C6D24E0ULL}, // 5^-245
+    {0xAECC49914078536DULL, 0x58FAE9F773886E18ULL}, // 5^-244
+    {0xDA7F5BF590966848ULL, 0xAF39A475506A899EULL}, // 5^-243
+    {0x888F99797A5E012DULL, 0x6D8406C952429603ULL}, // 5^-242
+    {0xAAB37FD7D8F58178ULL, 0xC8E5087BA6D33B83ULL}, // 5^-241
+    {0xD5605FCDCF32E1D6ULL, 0xFB1E4A9A90880A64ULL}, // 5^-240
+    {0x855C3BE0A17FCD26ULL, 0x5CF2EEA09A55067FULL}, // 5^-239
+    {0xA6B34AD8C9DFC06FULL, 0xF42FAA48C0EA481EULL}, // 5^-238
+    {0xD0601D8EFC57B08BULL, 0xF13B94DAF124DA26ULL}, // 5^-237
+    {0x823C12795DB6CE57ULL, 0x76C53D08D6B70858ULL}, // 5^-236
+    {0xA2CB1717B52481EDULL, 0x54768C4B0C64CA6EULL}, // 5^-235
+    {0xCB7DDCDDA26DA268ULL, 0xA9942F5DCF7DFD09ULL}, // 5^-234
+    {0xFE5D54150B090B02ULL, 0xD3F93B35435D7C4CULL}, // 5^-233
+    {0x9EFA548D26E5A6E1ULL, 0xC47BC5014A1A6DAFULL}, // 5^-232
+    {0xC6B8E9B0709F109AULL, 0x359AB6419CA1091BULL}, // 5^-231
+    {0xF867241C8CC6D4C0ULL, 0xC30163D203C94B62ULL}, // 5^-230
+    {0x9B407691D7FC44F8ULL, 0x79E0DE63425DCF1DULL}, // 5^-229
+    {0xC21094364DFB5636ULL, 0x985915FC12F542E4ULL}, // 5^-228
+    {0xF294B943E17A2BC4ULL, 0x3E6F5B7B17B2939DULL}, // 5^-227
+    {0x979CF3CA6CEC5B5AULL, 0xA705992CEECF9C42ULL}, // 5^-226
+    {0xBD8430BD08277231ULL, 0x50C6FF782A838353ULL}, // 5^-225
+    {0xECE53CEC4A314EBDULL, 0xA4F8BF5635246428ULL}, // 5^-224
+    {0x940F4613AE5ED136ULL, 0x871B7795E136BE99ULL}, // 5^-223
+    {0xB913179899F68584ULL, 0x28E2557B59846E3FULL}, // 5^-222
+    {0xE757DD7EC07426E5ULL, 0x331AEADA2FE589CFULL}, // 5^-221
+    {0x9096EA6F3848984FULL, 0x3FF0D2C85DEF7621ULL}, // 5^-220
+    {0xB4BCA50B065ABE63ULL, 0x0FED077A756B53A9ULL}, // 5^-219
+    {0xE1EBCE4DC7F16DFBULL, 0xD3E8495912C62894ULL}, // 5^-218
+    {0x8D3360F09CF6E4BDULL, 0x64712DD7ABBBD95CULL}, // 5^-217
+    {0xB080392CC4349DECULL, 0xBD8D794D96AACFB3ULL}, // 5^-216
+    {0xDCA04777F541C567ULL, 0xECF0D7A0FC5583A0ULL}, // 5^-215
+    {0x89E42CAAF9491B60ULL, 0xF41686C49DB57244ULL}, // 5^-214
+    {0xAC5D37D5B79B6239ULL, 0x311C2875C522CED5ULL}, // 5^-213
+    {0xD77485CB25823AC7ULL, 0x7D633293366B828BULL}, // 5^-212
+    {0x86A8D39EF77164BCULL, 0xAE5DFF9C02033197ULL}, // 5^-211
+    {0xA8530886B54DBDEBULL, 0xD9F57F830283FDFCULL}, // 5^-210
+    {0xD267CAA862A12D66ULL, 0xD072DF63C324FD7BULL}, // 5^-209
+    {0x8380DEA93DA4BC60ULL, 0x4247CB9E59F71E6DULL}, // 5^-208
+    {0xA46116538D0DEB78ULL, 0x52D9BE85F074E608ULL}, // 5^-207
+    {0xCD795BE870516656ULL, 0x67902E276C921F8BULL}, // 5^-206
+    {0x806BD9714632DFF6ULL, 0x00BA1CD8A3DB53B6ULL}, // 5^-205
+    {0xA086CFCD97BF97F3ULL, 0x80E8A40ECCD228A4ULL}, // 5^-204
+    {0xC8A883C0FDAF7DF0ULL, 0x6122CD128006B2CDULL}, // 5^-203
+    {0xFAD2A4B13D1B5D6CULL, 0x796B805720085F81ULL}, // 5^-202
+    {0x9CC3A6EEC6311A63ULL, 0xCBE3303674053BB0ULL}, // 5^-201
+    {0xC3F490AA77BD60FCULL, 0xBEDBFC4411068A9CULL}, // 5^-200
+    {0xF4F1B4D515ACB93BULL, 0xEE92FB5515482D44ULL}, // 5^-199
+    {0x991711052D8BF3C5ULL, 0x751BDD152D4D1C4AULL}, // 5^-198
+    {0xBF5CD54678EEF0B6ULL, 0xD262D45A78A0635DULL}, // 5^-197
+    {0xEF340A98172AACE4ULL, 0x86FB897116C87C34ULL}, // 5^-196
+    {0x9580869F0E7AAC0EULL, 0xD45D35E6AE3D4DA0ULL}, // 5^-195
+    {0xBAE0A846D2195712ULL, 0x8974836059CCA109ULL}, // 5^-194
+    {0xE998D258869FACD7ULL, 0x2BD1A438703FC94BULL}, // 5^-193
+    {0x91FF83775423CC06ULL, 0x7B6306A34627DDCFULL}, // 5^-192
+    {0xB67F6455292CBF08ULL, 0x1A3BC84C17B1D542ULL}, // 5^-191
+    {0xE41F3D6A7377EECAULL, 0x20CABA5F1D9E4A93ULL}, // 5^-190
+    {0x8E938662882AF53EULL, 0x547EB47B7282EE9CULL}, // 5^-189
+    {0xB23867FB2A35B28DULL, 0xE99E619A4F23AA43ULL}, // 5^-188
+    {0xDEC681F9F4C31F31ULL, 0x6405FA00E2EC94D4ULL}, // 5^-187
+    {0x8B3C113C38F9F37EULL, 0xDE83BC408DD3DD04ULL}, // 5^-186
+    {0xAE0B158B4738705EULL, 0x9624AB50B148D445ULL}, // 5^-185
+    {0xD98DDAEE19068C76ULL, 0x3BADD624DD9B0957ULL}, // 5^-184
+    {0x87F8A8D4CFA417C9ULL, 0xE54CA5D70A80E5D6ULL}, // 5^-183
+    {0xA9F6D30A038D1DBCULL, 0x5E9FCF4CCD211F4CULL}, // 5^-182
+    {0xD47487CC8470652BULL, 0x7647C3200069671FULL}, // 5^-181
+    {0x84C8D4DFD2C63F3BULL, 0x29ECD9F40041E073ULL}, // 5^-180
+    {0xA5FB0A17C777CF09ULL, 0xF468107100525890ULL}, // 5^-179
+    {0xCF79CC9DB955C2CCULL, 0x7182148D4066EEB4ULL}, // 5^-178
+    {0x81AC1FE293D599BFULL, 0xC6F14CD848405530ULL}, // 5^-177
+    {0xA21727DB38CB002FULL, 0xB8ADA00E5A506A7CULL}, // 5^-176
+    {0xCA9CF1D206FDC03BULL, 0xA6D90811F0E4851CULL}, // 5^-175
+    {0xFD442E4688BD304AULL, 0x908F4A166D1DA663ULL}, // 5^-174
+    {0x9E4A9CEC15763E2EULL, 0x9A598E4E043287FEULL}, // 5^-173
+    {0xC5DD44271AD3CDBAULL, 0x40EFF1E1853F29FDULL}, // 5^-172
+    {0xF7549530E188C128ULL, 0xD12BEE59E68EF47CULL}, // 5^-171
+    {0x9A94DD3E8CF578B9ULL, 0x82BB74F8301958CEULL}, // 5^-170
+    {0xC13A148E3032D6E7ULL, 0xE36A52363C1FAF01ULL}, // 5^-169
+    {0xF18899B1BC3F8CA1ULL, 0xDC44E6C3CB279AC1ULL}, // 5^-168
+    {0x96F5600F15A7B7E5ULL, 0x29AB103A5EF8C0B9ULL}, // 5^-167
+    {0xBCB2B812DB11A5DEULL, 0x7415D448F6B6F0E7ULL}, // 5^-166
+    {0xEBDF661791D60F56ULL, 0x111B495B3464AD21ULL}, // 5^-165
+    {0x936B9FCEBB25C995ULL, 0xCAB10DD900BEEC34ULL}, // 5^-164
+    {0xB84687C269EF3BFBULL, 0x3D5D514F40EEA742ULL}, // 5^-163
+    {0xE65829B3046B0AFAULL, 0x0CB4A5A3112A5112ULL}, // 5^-162
+    {0x8FF71A0FE2C2E6DCULL, 0x47F0E785EABA72ABULL}, // 5^-161
+    {0xB3F4E093DB73A093ULL, 0x59ED216765690F56ULL}, // 5^-160
+    {0xE0F218B8D25088B8ULL, 0x306869C13EC3532CULL}, // 5^-159
+    {0x8C974F7383725573ULL, 0x1E414218C73A13FBULL}, // 5^-158
+    {0xAFBD2350644EEACFULL, 0xE5D1929EF90898FAULL}, // 5^-157
+    {0xDBAC6C247D62A583ULL, 0xDF45F746B74ABF39ULL}, // 5^-156
+    {0x894BC396CE5DA772ULL, 0x6B8BBA8C328EB783ULL}, // 5^-155
+    {0xAB9EB47C81F5114FULL, 0x066EA92F3F326564ULL}, // 5^-154
+    {0xD686619BA27255A2ULL, 0xC80A537B0EFEFEBDULL}, // 5^-153
+    {0x8613FD0145877585ULL, 0xBD06742CE95F5F36ULL}, // 5^-152
+    {0xA798FC4196E952E7ULL, 0x2C48113823B73704ULL}, // 5^-151
+    {0xD17F3B51FCA3A7A0ULL, 0xF75A15862CA504C5ULL}, // 5^-150
+    {0x82EF85133DE648C4ULL, 0x9A984D73DBE722FBULL}, // 5^-149
+    {0xA3AB66580D5FDAF5ULL, 0xC13E60D0D2E0EBBAULL}, // 5^-148
+    {0xCC963FEE10B7D1B3ULL, 0x318DF905079926A8ULL}, // 5^-147
+    {0xFFBBCFE994E5C61FULL, 0xFDF17746497F7052ULL}, // 5^-146
+    {0x9FD561F1FD0F9BD3ULL, 0xFEB6EA8BEDEFA633ULL}, // 5^-145
+    {0xC7CABA6E7C5382C8ULL, 0xFE64A52EE96B8FC0ULL}, // 5^-144
+    {0xF9BD690A1B68637BULL, 0x3DFDCE7AA3C673B0ULL}, // 5^-143
+    {0x9C1661A651213E2DULL, 0x06BEA10CA65C084EULL}, // 5^-142
+    {0xC31BFA0FE5698DB8ULL, 0x486E494FCFF30A62ULL}, // 5^-141
+    {0xF3E2F893DEC3F126ULL, 0x5A89DBA3C3EFCCFAULL}, // 5^-140
+    {0x986DDB5C6B3A76B7ULL, 0xF89629465A75E01CULL}, // 5^-139
+    {0xBE89523386091465ULL, 0xF6BBB397F1135823ULL}, // 5^-138
+    {0xEE2BA6C0678B597FULL, 0x746AA07DED582E2CULL}, // 5^-137
+    {0x94DB483840B717EFULL, 0xA8C2A44EB4571CDCULL}, // 5^-136
+    {0xBA121A4650E4DDEBULL, 0x92F34D62616CE413ULL}, // 5^-135
+    {0xE896A0D7E51E1566ULL, 0x77B020BAF9C81D17ULL}, // 5^-134
+    {0x915E2486EF32CD60ULL, 0x0ACE1474DC1D122EULL}, // 5^-133
+    {0xB5B5ADA8AAFF80B8ULL, 0x0D819992132456BAULL}, // 5^-132
+    {0xE3231912D5BF60E6ULL, 0x10E1FFF697ED6C69ULL}, // 5^-131
+    {0x8DF5EFABC5979C8FULL, 0xCA8D3FFA1EF463C1ULL}, // 5^-130
+    {0xB1736B96B6FD83B3ULL, 0xBD308FF8A6B17CB2ULL}, // 5^-129
+    {0xDDD0467C64BCE4A0ULL, 0xAC7CB3F6D05DDBDEULL}, // 5^-128
+    {0x8AA22C0DBEF60EE4ULL, 0x6BCDF07A423AA96BULL}, // 5^-127
+    {0xAD4AB7112EB3929DULL, 0x86C16C98D2C953C6ULL}, // 5^-126
+    {0xD89D64D57A607744ULL, 0xE871C7BF077BA8B7ULL}, // 5^-125
+    {0x87625F056C7C4A8BULL, 0x11471CD764AD4972ULL}, // 5^-124
+    {0xA93AF6C6C79B5D2DULL, 0xD598E40D3DD89BCFULL}, // 5^-123
+    {0xD389B47879823479ULL, 0x4AFF1D108D4EC2C3ULL}, // 5^-122
+    {0x843610CB4BF160CBULL, 0xCEDF722A585139BAULL}, // 5^-121
+    {0xA54394FE1EEDB8FEULL, 0xC2974EB4EE658828ULL}, // 5^-120
+    {0xCE947A3DA6A9273EULL, 0x733D226229FEEA32ULL}, // 5^-119
+    {0x811CCC668829B887ULL, 0x0806357D5A3F525FULL}, // 5^-118
+    {0xA163FF802A3426A8ULL, 0xCA07C2DCB0CF26F7ULL}, // 5^-117
+    {0xC9BCFF6034C13052ULL, 0xFC89B393DD02F0B5ULL}, // 5^-116
+    {0xFC2C3F3841F17C67ULL, 0xBBAC2078D443ACE2ULL}, // 5^-115
+    {0x9D9BA7832936EDC0ULL, 0xD54B944B84AA4C0DULL}, // 5^-114
+    {0xC5029163F384A931ULL, 0x0A9E795E65D4DF11ULL}, // 5^-113
+    {0xF64335BCF065D37DULL, 0x4D4617B5FF4A16D5ULL}, // 5^-112
+    {0x99EA0196163FA42EULL, 0x504BCED1BF8E4E45ULL}, // 5^-111
+    {0xC06481FB9BCF8D39ULL, 0xE45EC2862F71E1D6ULL}, // 5^-110
+    {0xF07DA27A82C37088ULL, 0x5D767327BB4E5A4CULL}, // 5^-109
+    {0x964E858C91BA2655ULL, 0x3A6A07F8D510F86FULL}, // 5^-108
+    {0xBBE226EFB628AFEAULL, 0x890489F70A55368BULL}, // 5^-107
+    {0xEADAB0ABA3B2DBE5ULL, 0x2B45AC74CCEA842EULL}, // 5^-106
+    {0x92C8AE6B464FC96FULL, 0x3B0B8BC90012929DULL}, // 5^-105
+    {0xB77ADA0617E3BBCBULL, 0x09CE6EBB40173744ULL}, // 5^-104
+    {0xE55990879DDCAABDULL, 0xCC420A6A101D0515ULL}, // 5^-103
+    {0x8F57FA54C2A9EAB6ULL, 0x9FA946824A12232DULL}, // 5^-102
+    {0xB32DF8E9F3546564ULL, 0x47939822DC96ABF9ULL}, // 5^-101
+    {0xDFF9772470297EBDULL, 0x59787E2B93BC56F7ULL}, // 5^-100
+    {0x8BFBEA76C619EF36ULL, 0x57EB4EDB3C55B65AULL}, // 5^-99
+    {0xAEFAE51477A06B03ULL, 0xEDE622920B6B23F1ULL}, // 5^-98
+    {0xDAB99E59958885C4ULL, 0xE95FAB368E45ECEDULL}, // 5^-97
+    {0x88B402F7FD75539BULL, 0x11DBCB0218EBB414ULL}, // 5^-96
+    {0xAAE103B5FCD2A881ULL, 0xD652BDC29F26A119ULL}, // 5^-95
+    {0xD59944A37C0752A2ULL, 0x4BE76D3346F0495FULL}, // 5^-94
+    {0x857FCAE62D8493A5ULL, 0x6F70A4400C562DDBULL}, // 5^-93
+    {0xA6DFBD9FB8E5B88EULL, 0xCB4CCD500F6BB952ULL}, // 5^-92
+    {0xD097AD07A71F26B2ULL, 0x7E2000A41346A7A7ULL}, // 5^-91
+    {0x825ECC24C873782FULL, 0x8ED400668C0C28C8ULL}, // 5^-90
+    {0xA2F67F2DFA90563BULL, 0x728900802F0F32FAULL}, // 5^-89
+    {0xCBB41EF979346BCAULL, 0x4F2B40A03AD2FFB9ULL}, // 5^-88
+    {0xFEA126B7D78186BCULL, 0xE2F610C84987BFA8ULL}, // 5^-87
+    {0x9F24B832E6B0F436ULL, 0x0DD9CA7D2DF4D7C9ULL}, // 5^-86
+    {0xC6EDE63FA05D3143ULL, 0x91503D1C79720DBBULL}, // 5^-85
+    {0xF8A95FCF88747D94ULL, 0x75A44C6397CE912AULL}, // 5^-84
+    {0x9B69DBE1B548CE7CULL, 0xC986AFBE3EE11ABAULL}, // 5^-83
+    {0xC24452DA229B021BULL, 0xFBE85BADCE996168ULL}, // 5^-82
+    {0xF2D56790AB41C2A2ULL, 0xFAE27299423FB9C3ULL}, // 5^-81
+    {0x97C560BA6B0919A5ULL, 0xDCCD879FC967D41AULL}, // 5^-80
+    {0xBDB6B8E905CB600FULL, 0x5400E987BBC1C920ULL}, // 5^-79
+    {0xED246723473E3813ULL, 0x290123E9AAB23B68ULL}, // 5^-78
+    {0x9436C0760C86E30BULL, 0xF9A0B6720AAF6521ULL}, // 5^-77
+    {0xB94470938FA89BCEULL, 0xF808E40E8D5B3E69ULL}, // 5^-76
+    {0xE7958CB87392C2C2ULL, 0xB60B1D1230B20E04ULL}, // 5^-75
+    {0x90BD77F3483BB9B9ULL, 0xB1C6F22B5E6F48C2ULL}, // 5^-74
+    {0xB4ECD5F01A4AA828ULL, 0x1E38AEB6360B1AF3ULL}, // 5^-73
+    {0xE2280B6C20DD5232ULL, 0x25C6DA63C38DE1B0ULL}, // 5^-72
+    {0x8D590723948A535FULL, 0x579C487E5A38AD0EULL}, // 5^-71
+    {0xB0AF48EC79ACE837ULL, 0x2D835A9DF0C6D851ULL}, // 5^-70
+    {0xDCDB1B2798182244ULL, 0xF8E431456CF88E65ULL}, // 5^-69
+    {0x8A08F0F8BF0F156BULL, 0x1B8E9ECB641B58FFULL}, // 5^-68
+    {0xAC8B2D36EED2DAC5ULL, 0xE272467E3D222F3FULL}, // 5^-67
+    {0xD7ADF884AA879177ULL, 0x5B0ED81DCC6ABB0FULL}, // 5^-66
+    {0x86CCBB52EA94BAEAULL, 0x98E947129FC2B4E9ULL}, // 5^-65
+    {0xA87FEA27A539E9A5ULL, 0x3F2398D747B36224ULL}, // 5^-64
+    {0xD29FE4B18E88640EULL, 0x8EEC7F0D19A03AADULL}, // 5^-63
+    {0x83A3EEEEF9153E89ULL, 0x1953CF68300424ACULL}, // 5^-62
+    {0xA48CEAAAB75A8E2BULL, 0x5FA8C3423C052DD7ULL}, // 5^-61
+    {0xCDB02555653131B6ULL, 0x3792F412CB06794DULL}, // 5^-60
+    {0x808E17555F3EBF11ULL, 0xE2BBD88BBEE40BD0ULL}, // 5^-59
+    {0xA0B19D2AB70E6ED6ULL, 0x5B6ACEAEAE9D0EC4ULL}, // 5^-58
+    {0xC8DE047564D20A8BULL, 0xF245825A5A445275ULL}, // 5^-57
+    {0xFB158592BE068D2EULL, 0xEED6E2F0F0D56712ULL}, // 5^-56
+    {0x9CED737BB6C4183DULL, 0x55464DD69685606BULL}, // 5^-55
+    {0xC428D05AA4751E4CULL, 0xAA97E14C3C26B886ULL}, // 5^-54
+    {0xF53304714D9265DFULL, 0xD53DD99F4B3066A8ULL}, // 5^-53
+    {0x993FE2C6D07B7FABULL, 0xE546A8038EFE4029ULL}, // 5^-52
+    {0xBF8FDB78849A5F96ULL, 0xDE98520472BDD033ULL}, // 5^-51
+    {0xEF73D256A5C0F77CULL, 0x963E66858F6D4440ULL}, // 5^-50
+    {0x95A8637627989AADULL, 0xDDE7001379A44AA8ULL}, // 5^-49
+    {0xBB127C53B17EC159ULL, 0x5560C018580D5D52ULL}, // 5^-48
+    {0xE9D71B689DDE71AFULL, 0xAAB8F01E6E10B4A6ULL}, // 5^-47
+    {0x9226712162AB070DULL, 0xCAB3961304CA70E8ULL}, // 5^-46
+    {0xB6B00D69BB55C8D1ULL, 0x3D607B97C5FD0D22ULL}, // 5^-45
+    {0xE45C10C42A2B3B05ULL, 0x8CB89A7DB77C506AULL}, // 5^-44
+    {0x8EB98A7A9A5B04E3ULL, 0x77F3608E92ADB242ULL}, // 5^-43
+    {0xB267ED1940F1C61CULL, 0x55F038B237591ED3ULL}, // 5^-42
+    {0xDF01E85F912E37A3ULL, 0x6B6C46DEC52F6688ULL}, // 5^-41
+    {0x8B61313BBABCE2C6ULL, 0x2323AC4B3B3DA015ULL}, // 5^-40
+    {0xAE397D8AA96C1B77ULL, 0xABEC975E0A0D081AULL}, // 5^-39
+    {0xD9C7DCED53C72255ULL, 0x96E7BD358C904A21ULL}, // 5^-38
+    {0x881CEA14545C7575ULL, 0x7E50D64177DA2E54ULL}, // 5^-37
+    {0xAA242499697392D2ULL, 0xDDE50BD1D5D0B9E9ULL}, // 5^-36
+    {0xD4AD2DBFC3D07787ULL, 0x955E4EC64B44E864ULL}, // 5^-35
+    {0x84EC3C97DA624AB4ULL, 0xBD5AF13BEF0B113EULL}, // 5^-34
+    {0xA6274BBDD0FADD61ULL, 0xECB1AD8AEACDD58EULL}, // 5^-33
+    {0xCFB11EAD453994BAULL, 0x67DE18EDA5814AF2ULL}, // 5^-32
+    {0x81CEB32C4B43FCF4ULL, 0x80EACF948770CED7ULL}, // 5^-31
+    {0xA2425FF75E14FC31ULL, 0xA1258379A94D028DULL}, // 5^-30
+    {0xCAD2F7F5359A3B3EULL, 0x096EE45813A04330ULL}, // 5^-29
+    {0xFD87B5F28300CA0DULL, 0x8BCA9D6E188853FCULL}, // 5^-28
+    {0x9E74D1B791E07E48ULL, 0x775EA264CF55347EULL}, // 5^-27
+    {0xC612062576589DDAULL, 0x95364AFE032A819EULL}, // 5^-26
+    {0xF79687AED3EEC551ULL, 0x3A83DDBD83F52205ULL}, // 5^-25
+    {0x9ABE14CD44753B52ULL, 0xC4926A9672793543ULL}, // 5^-24
+    {0xC16D9A0095928A27ULL, 0x75B7053C0F178294ULL}, // 5^-23
+    {0xF1C90080BAF72CB1ULL, 0x5324C68B12DD6339ULL}, // 5^-22
+    {0x971DA05074DA7BEEULL, 0xD3F6FC16EBCA5E04ULL}, // 5^-21
+    {0xBCE5086492111AEAULL, 0x88F4BB1CA6BCF585ULL}, // 5^-20
+    {0xEC1E4A7DB69561A5ULL, 0x2B31E9E3D06C32E6ULL}, // 5^-19
+    {0x9392EE8E921D5D07ULL, 0x3AFF322E62439FD0ULL}, // 5^-18
+    {0xB877AA3236A4B449ULL, 0x09BEFEB9FAD487C3ULL}, // 5^-17
+    {0xE69594BEC44DE15BULL, 0x4C2EBE687989A9B4ULL}, // 5^-16
+    {0x901D7CF73AB0ACD9ULL, 0x0F9D37014BF60A11ULL}, // 5^-15
+    {0xB424DC35095CD80FULL, 0x538484C19EF38C95ULL}, // 5^-14
+    {0xE12E13424BB40E13ULL, 0x2865A5F206B06FBAULL}, // 5^-13
+    {0x8CBCCC096F5088CBULL, 0xF93F87B7442E45D4ULL}, // 5^-12
+    {0xAFEBFF0BCB24AAFEULL, 0xF78F69A51539D749ULL}, // 5^-11
+    {0xDBE6FECEBDEDD5BEULL, 0xB573440E5A884D1CULL}, // 5^-10
+    {0x89705F4136B4A597ULL, 0x31680A88F8953031ULL}, // 5^-9
+    {0xABCC77118461CEFCULL, 0xFDC20D2B36BA7C3EULL}, // 5^-8
+    {0xD6BF94D5E57A42BCULL, 0x3D32907604691B4DULL}, // 5^-7
+    {0x8637BD05AF6C69B5ULL, 0xA63F9A49C2C1B110ULL}, // 5^-6
+    {0xA7C5AC471B478423ULL, 0x0FCF80DC33721D54ULL}, // 5^-5
+    {0xD1B71758E219652BULL, 0xD3C36113404EA4A9ULL}, // 5^-4
+    {0x83126E978D4FDF3BULL, 0x645A1CAC083126EAULL}, // 5^-3
+    {0xA3D70A3D70A3D70AULL, 0x3D70A3D70A3D70A4ULL}, // 5^-2
+    {0xCCCCCCCCCCCCCCCCULL, 0xCCCCCCCCCCCCCCCDULL}, // 5^-1
+    {0x8000000000000000ULL, 0x0000000000000000ULL}, // 5^0
+    {0xA000000000000000ULL, 0x0000000000000000ULL}, // 5^1
+    {0xC800000000000000ULL, 0x0000000000000000ULL}, // 5^2
+    {0xFA00000000000000ULL, 0x0000000000000000ULL}, // 5^3
+    {0x9C40000000000000ULL, 0x0000000000000000ULL}, // 5^4
+    {0xC350000000000000ULL, 0x0000000000000000ULL}, // 5^5
+    {0xF424000000000000ULL, 0x0000000000000000ULL}, // 5^6
+    {0x9896800000000000ULL, 0x0000000000000000ULL}, // 5^7
+    {0xBEBC200000000000ULL, 0x0000000000000000ULL}, // 5^8
+    {0xEE6B280000000000ULL, 0x0000000000000000ULL}, // 5^9
+    {0x9502F90000000000ULL, 0x0000000000000000ULL}, // 5^10
+    {0xBA43B74000000000ULL, 0x0000000000000000ULL}, // 5^11
+    {0xE8D4A51000000000ULL, 0x0000000000000000ULL}, // 5^12
+    {0x9184E72A00000000ULL, 0x0000000000000000ULL}, // 5^13
+    {0xB5E620F480000000ULL, 0x0000000000000000ULL}, // 5^14
+    {0xE35FA931A0000000ULL, 0x0000000000000000ULL}, // 5^15
+    {0x8E1BC9BF04000000ULL, 0x0000000000000000ULL}, // 5^16
+    {0xB1A2BC2EC5000000ULL, 0x0000000000000000ULL}, // 5^17
+    {0xDE0B6B3A76400000ULL, 0x0000000000000000ULL}, // 5^18
+    {0x8AC7230489E80000ULL, 0x0000000000000000ULL}, // 5^19
+    {0xAD78EBC5AC620000ULL, 0x0000000000000000ULL}, // 5^20
+    {0xD8D726B7177A8000ULL, 0x0000000000000000ULL}, // 5^21
+    {0x878678326EAC9000ULL, 0x0000000000000000ULL}, // 5^22
+    {0xA968163F0A57B400ULL, 0x0000000000000000ULL}, // 5^23
+    {0xD3C21BCECCEDA100ULL, 0x0000000000000000ULL}, // 5^24
+    {0x84595161401484A0ULL, 0x0000000000000000ULL}, // 5^25
+    {0xA56FA5B99019A5C8ULL, 0x0000000000000000ULL}, // 5^26
+    {0xCECB8F27F4200F3AULL, 0x0000000000000000ULL}, // 5^27
+    {0x813F3978F8940984ULL, 0x4000000000000000ULL}, // 5^28
+    {0xA18F07D736B90BE5ULL, 0x5000000000000000ULL}, // 5^29
+    {0xC9F2C9CD04674EDEULL, 0xA400000000000000ULL}, // 5^30
+    {0xFC6F7C4045812296ULL, 0x4D00000000000000ULL}, // 5^31
+    {0x9DC5ADA82B70B59DULL, 0xF020000000000000ULL}, // 5^32
+    {0xC5371912364CE305ULL, 0x6C28000000000000ULL}, // 5^33
+    {0xF684DF56C3E01BC6ULL, 0xC732000000000000ULL}, // 5^34
+    {0x9A130B963A6C115CULL, 0x3C7F400000000000ULL}, // 5^35
+    {0xC097CE7BC90715B3ULL, 0x4B9F100000000000ULL}, // 5^36
+    {0xF0BDC21ABB48DB20ULL, 0x1E86D40000000000ULL}, // 5^37
+    {0x96769950B50D88F4ULL, 0x1314448000000000ULL}, // 5^38
+    {0xBC143FA4E250EB31ULL, 0x17D955A000000000ULL}, // 5^39
+    {0xEB194F8E1AE525FDULL, 0x5DCFAB0800000000ULL}, // 5^40
+    {0x92EFD1B8D0CF37BEULL, 0x5AA1CAE500000000ULL}, // 5^41
+    {0xB7ABC627050305ADULL, 0xF14A3D9E40000000ULL}, // 5^42
+    {0xE596B7B0C643C719ULL, 0x6D9CCD05D0000000ULL}, // 5^43
+    {0x8F7E32CE7BEA5C6FULL, 0xE4820023A2000000ULL}, // 5^44
+    {0xB35DBF821AE4F38BULL, 0xDDA2802C8A800000ULL}, // 5^45
+    {0xE0352F62A19E306EULL, 0xD50B2037AD200000ULL}, // 5^46
+    {0x8C213D9DA502DE45ULL, 0x4526F422CC340000ULL}, // 5^47
+    {0xAF298D050E4395D6ULL, 0x9670B12B7F410000ULL}, // 5^48
+    {0xDAF3F04651D47B4CULL, 0x3C0CDD765F114000ULL}, // 5^49
+    {0x88D8762BF324CD0FULL, 0xA5880A69FB6AC800ULL}, // 5^50
+    {0xAB0E93B6EFEE0053ULL, 0x8EEA0D047A457A00ULL}, // 5^51
+    {0xD5D238A4ABE98068ULL, 0x72A4904598D6D880ULL}, // 5^52
+    {0x85A36366EB71F041ULL, 0x47A6DA2B7F864750ULL}, // 5^53
+    {0xA70C3C40A64E6C51ULL, 0x999090B65F67D924ULL}, // 5^54
+    {0xD0CF4B50CFE20765ULL, 0xFFF4B4E3F741CF6DULL}, // 5^55
+    {0x82818F1281ED449FULL, 0xBFF8F10E7A8921A4ULL}, // 5^56
+    {0xA321F2D7226895C7ULL, 0xAFF72D52192B6A0DULL}, // 5^57
+    {0xCBEA6F8CEB02BB39ULL, 0x9BF4F8A69F764490ULL}, // 5^58
+    {0xFEE50B7025C36A08ULL, 0x02F236D04753D5B4ULL}, // 5^59
+    {0x9F4F2726179A2245ULL, 0x01D762422C946590ULL}, // 5^60
+    {0xC722F0EF9D80AAD6ULL, 0x424D3AD2B7B97EF5ULL}, // 5^61
+    {0xF8EBAD2B84E0D58BULL, 0xD2E0898765A7DEB2ULL}, // 5^62
+    {0x9B934C3B330C8577ULL, 0x63CC55F49F88EB2FULL}, // 5^63
+    {0xC2781F49FFCFA6D5ULL, 0x3CBF6B71C76B25FBULL}, // 5^64
+    {0xF316271C7FC3908AULL, 0x8BEF464E3945EF7AULL}, // 5^65
+    {0x97EDD871CFDA3A56ULL, 0x97758BF0E3CBB5ACULL}, // 5^66
+    {0xBDE94E8E43D0C8ECULL, 0x3D52EEED1CBEA317ULL}, // 5^67
+    {0xED63A231D4C4FB27ULL, 0x4CA7AAA863EE4BDDULL}, // 5^68
+    {0x945E455F24FB1CF8ULL, 0x8FE8CAA93E74EF6AULL}, // 5^69
+    {0xB975D6B6EE39E436ULL, 0xB3E2FD538E122B44ULL}, // 5^70
+    {0xE7D34C64A9C85D44ULL, 0x60DBBCA87196B616ULL}, // 5^71
+    {0x90E40FBEEA1D3A4AULL, 0xBC8955E946FE31CDULL}, // 5^72
+    {0xB51D13AEA4A488DDULL, 0x6BABAB6398BDBE41ULL}, // 5^73
+    {0xE264589A4DCDAB14ULL, 0xC696963C7EED2DD1ULL}, // 5^74
+    {0x8D7EB76070A08AECULL, 0xFC1E1DE5CF543CA2ULL}, // 5^75
+    {0xB0DE65388CC8ADA8ULL, 0x3B25A55F43294BCBULL}, // 5^76
+    {0xDD15FE86AFFAD912ULL, 0x49EF0EB713F39EBEULL}, // 5^77
+    {0x8A2DBF142DFCC7ABULL, 0x6E3569326C784337ULL}, // 5^78
+    {0xACB92ED9397BF996ULL, 0x49C2C37F07965404ULL}, // 5^79
+    {0xD7E77A8F87DAF7FBULL, 0xDC33745EC97BE906ULL}, // 5^80
+    {0x86F0AC99B4E8DAFDULL, 0x69A028BB3DED71A3ULL}, // 5^81
+    {0xA8ACD7C0222311BCULL, 0xC40832EA0D68CE0CULL}, // 5^82
+    {0xD2D80DB02AABD62BULL, 0xF50A3FA490C30190ULL}, // 5^83
+    {0x83C7088E1AAB65DBULL, 0x792667C6DA79E0FAULL}, // 5^84
+    {0xA4B8CAB1A1563F52ULL, 0x577001B891185938ULL}, // 5^85
+    {0xCDE6FD5E09ABCF26ULL, 0xED4C0226B55E6F86ULL}, // 5^86
+    {0x80B05E5AC60B6178ULL, 0x544F8158315B05B4ULL}, // 5^87
+    {0xA0DC75F1778E39D6ULL, 0x696361AE3DB1C721ULL}, // 5^88
+    {0xC913936DD571C84CULL, 0x03BC3A19CD1E38E9ULL}, // 5^89
+    {0xFB5878494ACE3A5FULL, 0x04AB48A04065C723ULL}, // 5^90
+    {0x9D174B2DCEC0E47BULL, 0x62EB0D64283F9C76ULL}, // 5^91
+    {0xC45D1DF942711D9AULL, 0x3BA5D0BD324F8394ULL}, // 5^92
+    {0xF5746577930D6500ULL, 0xCA8F44EC7EE36479ULL}, // 5^93
+    {0x9968BF6ABBE85F20ULL, 0x7E998B13CF4E1ECBULL}, // 5^94
+    {0xBFC2EF456AE276E8ULL, 0x9E3FEDD8C321A67EULL}, // 5^95
+    {0xEFB3AB16C59B14A2ULL, 0xC5CFE94EF3EA101EULL}, // 5^96
+    {0x95D04AEE3B80ECE5ULL, 0xBBA1F1D158724A12ULL}, // 5^97
+    {0xBB445DA9CA61281FULL, 0x2A8A6E45AE8EDC97ULL}, // 5^98
+    {0xEA1575143CF97226ULL, 0xF52D09D71A3293BDULL}, // 5^99
+    {0x924D692CA61BE758ULL, 0x593C2626705F9C56ULL}, // 5^100
+    {0xB6E0C377CFA2E12EULL, 0x6F8B2FB00C77836CULL}, // 5^101
+    {0xE498F455C38B997AULL, 0x0B6DFB9C0F956447ULL}, // 5^102
+    {0x8EDF98B59A373FECULL, 0x4724BD4189BD5EACULL}, // 5^103
+    {0xB2977EE300C50FE7ULL, 0x58EDEC91EC2CB657ULL}, // 5^104
+    {0xDF3D5E9BC0F653E1ULL, 0x2F2967B66737E3EDULL}, // 5^105
+    {0x8B865B215899F46CULL, 0xBD79E0D20082EE74ULL}, // 5^106
+    {0xAE67F1E9AEC07187ULL, 0xECD8590680A3AA11ULL}, // 5^107
+    {0xDA01EE641A708DE9ULL, 0xE80E6F4820CC9495ULL}, // 5^108
+    {0x884134FE908658B2ULL, 0x3109058D147FDCDDULL}, // 5^109
+    {0xAA51823E34A7EEDEULL, 0xBD4B46F0599FD415ULL}, // 5^110
+    {0xD4E5E2CDC1D1EA96ULL, 0x6C9E18AC7007C91AULL}, // 5^111
+    {0x850FADC09923329EULL, 0x03E2CF6BC604DDB0ULL}, // 5^112
+    {0xA6539930BF6BFF45ULL, 0x84DB8346B786151CULL}, // 5^113
+    {0xCFE87F7CEF46FF16ULL, 0xE612641865679A63ULL}, // 5^114
+    {0x81F14FAE158C5F6EULL, 0x4FCB7E8F3F60C07EULL}, // 5^115
+    {0xA26DA3999AEF7749ULL, 0xE3BE5E330F38F09DULL}, // 5^116
+    {0xCB090C8001AB551CULL, 0x5CADF5BFD3072CC5ULL}, // 5^117
+    {0xFDCB4FA002162A63ULL, 0x73D9732FC7C8F7F6ULL}, // 5^118
+    {0x9E9F11C4014DDA7EULL, 0x2867E7FDDCDD9AFAULL}, // 5^119
+    {0xC646D63501A1511DULL, 0xB281E1FD541501B8ULL}, // 5^120
+    {0xF7D88BC24209A565ULL, 0x1F225A7CA91A4226ULL}, // 5^121
+    {0x9AE757596946075FULL, 0x3375788DE9B06958ULL}, // 5^122
+    {0xC1A12D2FC3978937ULL, 0x0052D6B1641C83AEULL}, // 5^123
+    {0xF209787BB47D6B84ULL, 0xC0678C5DBD23A49AULL}, // 5^124
+    {0x9745EB4D50CE6332ULL, 0xF840B7BA963646E0ULL}, // 5^125
+    {0xBD176620A501FBFFULL, 0xB650E5A93BC3D898ULL}, // 5^126
+    {0xEC5D3FA8CE427AFFULL, 0xA3E51F138AB4CEBEULL}, // 5^127
+    {0x93BA47C980E98CDFULL, 0xC66F336C36B10137ULL}, // 5^128
+    {0xB8A8D9BBE123F017ULL, 0xB80B0047445D4184ULL}, // 5^129
+    {0xE6D3102AD96CEC1DULL, 0xA60DC059157491E5ULL}, // 5^130
+    {0x9043EA1AC7E41392ULL, 0x87C89837AD68DB2FULL}, // 5^131
+    {0xB454E4A179DD1877ULL, 0x29BABE4598C311FBULL}, // 5^132
+    {0xE16A1DC9D8545E94ULL, 0xF4296DD6FEF3D67AULL}, // 5^133
+    {0x8CE2529E2734BB1DULL, 0x1899E4A65F58660CULL}, // 5^134
+    {0xB01AE745B101E9E4ULL, 0x5EC05DCFF72E7F8FULL}, // 5^135
+    {0xDC21A1171D42645DULL, 0x76707543F4FA1F73ULL}, // 5^136
+    {0x899504AE72497EBAULL, 0x6A06494A791C53A8ULL}, // 5^137
+    {0xABFA45DA0EDBDE69ULL, 0x0487DB9D17636892ULL}, // 5^138
+    {0xD6F8D7509292D603ULL, 0x45A9D2845D3C42B6ULL}, // 5^139
+    {0x865B86925B9BC5C2ULL, 0x0B8A2392BA45A9B2ULL}, // 5^140
+    {0xA7F26836F282B732ULL, 0x8E6CAC7768D7141EULL}, // 5^141
+    {0xD1EF0244AF2364FFULL, 0x3207D795430CD926ULL}, // 5^142
+    {0x8335616AED761F1FULL, 0x7F44E6BD49E807B8ULL}, // 5^143
+    {0xA402B9C5A8D3A6E7ULL, 0x5F16206C9C6209A6ULL}, // 5^144
+    {0xCD036837130890A1ULL, 0x36DBA887C37A8C0FULL}, // 5^145
+    {0x802221226BE55A64ULL, 0xC2494954DA2C9789ULL}, // 5^146
+    {0xA02AA96B06DEB0FDULL, 0xF2DB9BAA10B7BD6CULL}, // 5^147
+    {0xC83553C5C8965D3DULL, 0x6F92829494E5ACC7ULL}, // 5^148
+    {0xFA42A8B73ABBF48CULL, 0xCB772339BA1F17F9ULL}, // 5^149
+    {0x9C69A97284B578D7ULL, 0xFF2A760414536EFBULL}, // 5^150
+    {0xC38413CF25E2D70DULL, 0xFEF5138519684ABAULL}, // 5^151
+    {0xF46518C2EF5B8CD1ULL, 0x7EB258665FC25D69ULL}, // 5^152
+    {0x98BF2F79D5993802ULL, 0xEF2F773FFBD97A61ULL}, // 5^153
+    {0xBEEEFB584AFF8603ULL, 0xAAFB550FFACFD8FAULL}, // 5^154
+    {0xEEAABA2E5DBF6784ULL, 0x95BA2A53F983CF38ULL}, // 5^155
+    {0x952AB45CFA97A0B2ULL, 0xDD945A747BF26183ULL}, // 5^156
+    {0xBA756174393D88DFULL, 0x94F971119AEEF9E4ULL}, // 5^157
+    {0xE912B9D1478CEB17ULL, 0x7A37CD5601AAB85DULL}, // 5^158
+    {0x91ABB422CCB812EEULL, 0xAC62E055C10AB33AULL}, // 5^159
+    {0xB616A12B7FE617AAULL, 0x577B986B314D6009ULL}, // 5^160
+    {0xE39C49765FDF9D94ULL, 0xED5A7E85FDA0B80BULL}, // 5^161
+    {0x8E41ADE9FBEBC27DULL, 0x14588F13BE847307ULL}, // 5^162
+    {0xB1D219647AE6B31CULL, 0x596EB2D8AE258FC8ULL}, // 5^163
+    {0xDE469FBD99A05FE3ULL, 0x6FCA5F8ED9AEF3BBULL}, // 5^164
+    {0x8AEC23D680043BEEULL, 0x25DE7BB9480D5854ULL}, // 5^165
+    {0xADA72CCC20054AE9ULL, 0xAF561AA79A10AE6AULL}, // 5^166
+    {0xD910F7FF28069DA4ULL, 0x1B2BA1518094DA04ULL}, // 5^167
+    {0x87AA9AFF79042286ULL, 0x90FB44D2F05D0842ULL}, // 5^168
+    {0xA99541BF57452B28ULL, 0x353A1607AC744A53ULL}, // 5^169
+    {0xD3FA922F2D1675F2ULL, 0x42889B8997915CE8ULL}, // 5^170
+    {0x847C9B5D7C2E09B7ULL, 0x69956135FEBADA11ULL}, // 5^171
+    {0xA59BC234DB398C25ULL, 0x43FAB9837E699095ULL}, // 5^172
+    {0xCF02B2C21207EF2EULL, 0x94F967E45E03F4BBULL}, // 5^173
+    {0x8161AFB94B44F57DULL, 0x1D1BE0EEBAC278F5ULL}, // 5^174
+    {0xA1BA1BA79E1632DCULL, 0x6462D92A69731732ULL}, // 5^175
+    {0xCA28A291859BBF93ULL, 0x7D7B8F7503CFDCFEULL}, // 5^176
+    {0xFCB2CB35E702AF78ULL, 0x5CDA735244C3D43EULL}, // 5^177
+    {0x9DEFBF01B061ADABULL, 0x3A0888136AFA64A7ULL}, // 5^178
+    {0xC56BAEC21C7A1916ULL, 0x088AAA1845B8FDD0ULL}, // 5^179
+    {0xF6C69A72A3989F5BULL, 0x8AAD549E57273D45ULL}, // 5^180
+    {0x9A3C2087A63F6399ULL, 0x36AC54E2F678864BULL}, // 5^181
+    {0xC0CB28A98FCF3C7FULL, 0x84576A1BB416A7DDULL}, // 5^182
+    {0xF0FDF2D3F3C30B9FULL, 0x656D44A2A11C51D5ULL}, // 5^183
+    {0x969EB7C47859E743ULL, 0x9F644AE5A4B1B325ULL}, // 5^184
+    {0xBC4665B596706114ULL, 0x873D5D9F0DDE1FEEULL}, // 5^185
+    {0xEB57FF22FC0C7959ULL, 0xA90CB506D155A7EAULL}, // 5^186
+    {0x9316FF75DD87CBD8ULL, 0x09A7F12442D588F2ULL}, // 5^187
+    {0xB7DCBF5354E9BECEULL, 0x0C11ED6D538AEB2FULL}, // 5^188
+    {0xE5D3EF282A242E81ULL, 0x8F1668C8A86DA5FAULL}, // 5^189
+    {0x8FA475791A569D10ULL, 0xF96E017D694487BCULL}, // 5^190
+    {0xB38D92D760EC4455ULL, 0x37C981DCC395A9ACULL}, // 5^191
+    {0xE070F78D3927556AULL, 0x85BBE253F47B1417ULL}, // 5^192
+    {0x8C469AB843B89562ULL, 0x93956D7478CCEC8EULL}, // 5^193
+    {0xAF58416654A6BABBULL, 0x387AC8D1970027B2ULL}, // 5^194
+    {0xDB2E51BFE9D0696AULL, 0x06997B05FCC0319EULL}, // 5^195
+    {0x88FCF317F22241E2ULL, 0x441FECE3BDF81F03ULL}, // 5^196
+    {0xAB3C2FDDEEAAD25AULL, 0xD527E81CAD7626C3ULL}, // 5^197
+    {0xD60B3BD56A5586F1ULL, 0x8A71E223D8D3B074ULL}, // 5^198
+    {0x85C7056562757456ULL, 0xF6872D5667844E49ULL}, // 5^199
+    {0xA738C6BEBB12D16CULL, 0xB428F8AC016561DBULL}, // 5^200
+    {0xD106F86E69D785C7ULL, 0xE13336D701BEBA52ULL}, // 5^201
+    {0x82A45B450226B39CULL, 0xECC0024661173473ULL}, // 5^202
+    {0xA34D721642B06084ULL, 0x27F002D7F95D0190ULL}, // 5^203
+    {0xCC20CE9BD35C78A5ULL, 0x31EC038DF7B441F4ULL}, // 5^204
+    {0xFF290242C83396CEULL, 0x7E67047175A15271ULL}, // 5^205
+    {0x9F79A169BD203E41ULL, 0x0F0062C6E984D386ULL}, // 5^206
+    {0xC75809C42C684DD1ULL, 0x52C07B78A3E60868ULL}, // 5^207
+    {0xF92E0C3537826145ULL, 0xA7709A56CCDF8A82ULL}, // 5^208
+    {0x9BBCC7A142B17CCBULL, 0x88A66076400BB691ULL}, // 5^209
+    {0xC2ABF989935DDBFEULL, 0x6ACFF893D00EA435ULL}, // 5^210
+    {0xF356F7EBF83552FEULL, 0x0583F6B8C4124D43ULL}, // 5^211
+    {0x98165AF37B2153DEULL, 0xC3727A337A8B704AULL}, // 5^212
+    {0xBE1BF1B059E9A8D6ULL, 0x744F18C0592E4C5CULL}, // 5^213
+    {0xEDA2EE1C7064130CULL, 0x1162DEF06F79DF73ULL}, // 5^214
+    {0x9485D4D1C63E8BE7ULL, 0x8ADDCB5645AC2BA8ULL}, // 5^215
+    {0xB9A74A0637CE2EE1ULL, 0x6D953E2BD7173692ULL}, // 5^216
+    {0xE8111C87C5C1BA99ULL, 0xC8FA8DB6CCDD0437ULL}, // 5^217
+    {0x910AB1D4DB9914A0ULL, 0x1D9C9892400A22A2ULL}, // 5^218
+    {0xB54D5E4A127F59C8ULL, 0x2503BEB6D00CAB4BULL}, // 5^219
+    {0xE2A0B5DC971F303AULL, 0x2E44AE64840FD61DULL}, // 5^220
+    {0x8DA471A9DE737E24ULL, 0x5CEAECFED289E5D2ULL}, // 5^221
+    {0xB10D8E1456105DADULL, 0x7425A83E872C5F47ULL}, // 5^222
+    {0xDD50F1996B947518ULL, 0xD12F124E28F77719ULL}, // 5^223
+    {0x8A5296FFE33CC92FULL, 0x82BD6B70D99AAA6FULL}, // 5^224
+    {0xACE73CBFDC0BFB7BULL, 0x636CC64D1001550BULL}, // 5^225
+    {0xD8210BEFD30EFA5AULL, 0x3C47F7E05401AA4EULL}, // 5^226
+    {0x8714A775E3E95C78ULL, 0x65ACFAEC34810A71ULL}, // 5^227
+    {0xA8D9D1535CE3B396ULL, 0x7F1839A741A14D0DULL}, // 5^228
+    {0xD31045A8341CA07CULL, 0x1EDE48111209A050ULL}, // 5^229
+    {0x83EA2B892091E44DULL, 0x934AED0AAB460432ULL}, // 5^230
+    {0xA4E4B66B68B65D60ULL, 0xF81DA84D5617853FULL}, // 5^231
+    {0xCE1DE40642E3F4B9ULL, 0x36251260AB9D668EULL}, // 5^232
+    {0x80D2AE83E9CE78F3ULL, 0xC1D72B7C6B426019ULL}, // 5^233
+    {0xA1075A24E4421730ULL, 0xB24CF65B8612F81FULL}, // 5^234
+    {0xC94930AE1D529CFCULL, 0xDEE033F26797B627ULL}, // 5^235
+    {0xFB9B7CD9A4A7443CULL, 0x169840EF017DA3B1ULL}, // 5^236
+    {0x9D412E0806E88AA5ULL, 0x8E1F289560EE864EULL}, // 5^237
+    {0xC491798A08A2AD4EULL, 0xF1A6F2BAB92A27E2ULL}, // 5^238
+    {0xF5B5D7EC8ACB58A2ULL, 0xAE10AF696774B1DBULL}, // 5^239
+    {0x9991A6F3D6BF1765ULL, 0xACCA6DA1E0A8EF29ULL}, // 5^240
+    {0xBFF610B0CC6EDD3FULL, 0x17FD090A58D32AF3ULL}, // 5^241
+    {0xEFF394DCFF8A948EULL, 0xDDFC4B4CEF07F5B0ULL}, // 5^242
+    {0x95F83D0A1FB69CD9ULL, 0x4ABDAF101564F98EULL}, // 5^243
+    {0xBB764C4CA7A4440FULL, 0x9D6D1AD41ABE37F1ULL}, // 5^244
+    {0xEA53DF5FD18D5513ULL, 0x84C86189216DC5EDULL}, // 5^245
+    {0x92746B9BE2F8552CULL, 0x32FD3CF5B4E49BB4ULL}, // 5^246
+    {0xB7118682DBB66A77ULL, 0x3FBC8C33221DC2A1ULL}, // 5^247
+    {0xE4D5E82392A40515ULL, 0x0FABAF3FEAA5334AULL}, // 5^248
+    {0x8F05B1163BA6832DULL, 0x29CB4D87F2A7400EULL}, // 5^249
+    {0xB2C71D5BCA9023F8ULL, 0x743E20E9EF511012ULL}, // 5^250
+    {0xDF78E4B2BD342CF6ULL, 0x914DA9246B255416ULL}, // 5^251
+    {0x8BAB8EEFB6409C1AULL, 0x1AD089B6C2F7548EULL}, // 5^252
+    {0xAE9672ABA3D0C320ULL, 0xA184AC2473B529B1ULL}, // 5^253
+    {0xDA3C0F568CC4F3E8ULL, 0xC9E5D72D90A2741EULL}, // 5^254
+    {0x8865899617FB1871ULL, 0x7E2FA67C7A658892ULL}, // 5^255
+    {0xAA7EEBFB9DF9DE8DULL, 0xDDBB901B98FEEAB7ULL}, // 5^256
+    {0xD51EA6FA85785631ULL, 0x552A74227F3EA565ULL}, // 5^257
+    {0x8533285C936B35DEULL, 0xD53A88958F87275FULL}, // 5^258
+    {0xA67FF273B8460356ULL, 0x8A892ABAF368F137ULL}, // 5^259
+    {0xD01FEF10A657842CULL, 0x2D2B7569B0432D85ULL}, // 5^260
+    {0x8213F56A67F6B29BULL, 0x9C3B29620E29FC73ULL}, // 5^261
+    {0xA298F2C501F45F42ULL, 0x8349F3BA91B47B8FULL}, // 5^262
+    {0xCB3F2F7642717713ULL, 0x241C70A936219A73ULL}, // 5^263
+    {0xFE0EFB53D30DD4D7ULL, 0xED238CD383AA0110ULL}, // 5^264
+    {0x9EC95D1463E8A506ULL, 0xF4363804324A40AAULL}, // 5^265
+    {0xC67BB4597CE2CE48ULL, 0xB143C6053EDCD0D5ULL}, // 5^266
+    {0xF81AA16FDC1B81DAULL, 0xDD94B7868E94050AULL}, // 5^267
+    {0x9B10A4E5E9913128ULL, 0xCA7CF2B4191C8326ULL}, // 5^268
+    {0xC1D4CE1F63F57D72ULL, 0xFD1C2F611F63A3F0ULL}, // 5^269
+    {0xF24A01A73CF2DCCFULL, 0xBC633B39673C8CECULL}, // 5^270
+    {0x976E41088617CA01ULL, 0xD5BE0503E085D813ULL}, // 5^271
+    {0xBD49D14AA79DBC82ULL, 0x4B2D8644D8A74E18ULL}, // 5^272
+    {0xEC9C459D51852BA2ULL, 0xDDF8E7D60ED1219EULL}, // 5^273
+    {0x93E1AB8252F33B45ULL, 0xCABB90E5C942B503ULL}, // 5^274
+    {0xB8DA1662E7B00A17ULL, 0x3D6A751F3B936243ULL}, // 5^275
+    {0xE7109BFBA19C0C9DULL, 0x0CC512670A783AD4ULL}, // 5^276
+    {0x906A617D450187E2ULL, 0x27FB2B80668B24C5ULL}, // 5^277
+    {0xB484F9DC9641E9DAULL, 0xB1F9F660802DEDF6ULL}, // 5^278
+    {0xE1A63853BBD26451ULL, 0x5E7873F8A0396973ULL}, // 5^279
+    {0x8D07E33455637EB2ULL, 0xDB0B487B6423E1E8ULL}, // 5^280
+    {0xB049DC016ABC5E5FULL, 0x91CE1A9A3D2CDA62ULL}, // 5^281
+    {0xDC5C5301C56B75F7ULL, 0x7641A140CC7810FBULL}, // 5^282
+    {0x89B9B3E11B6329BAULL, 0xA9E904C87FCB0A9DULL}, // 5^283
+    {0xAC2820D9623BF429ULL, 0x546345FA9FBDCD44ULL}, // 5^284
+    {0xD732290FBACAF133ULL, 0xA97C177947AD4095ULL}, // 5^285
+    {0x867F59A9D4BED6C0ULL, 0x49ED8EABCCCC485DULL}, // 5^286
+    {0xA81F301449EE8C70ULL, 0x5C68F256BFFF5A74ULL}, // 5^287
+    {0xD226FC195C6A2F8CULL, 0x73832EEC6FFF3111ULL}, // 5^288
+    {0x83585D8FD9C25DB7ULL, 0xC831FD53C5FF7EABULL}, // 5^289
+    {0xA42E74F3D032F525ULL, 0xBA3E7CA8B77F5E55ULL}, // 5^290
+    {0xCD3A1230C43FB26FULL, 0x28CE1BD2E55F35EBULL}, // 5^291
+    {0x80444B5E7AA7CF85ULL, 0x7980D163CF5B81B3ULL}, // 5^292
+    {0xA0555E361951C366ULL, 0xD7E105BCC332621FULL}, // 5^293
+    {0xC86AB5C39FA63440ULL, 0x8DD9472BF3FEFAA7ULL}, // 5^294
+    {0xFA856334878FC150ULL, 0xB14F98F6F0FEB951ULL}, // 5^295
+    {0x9C935E00D4B9D8D2ULL, 0x6ED1BF9A569F33D3ULL}, // 5^296
+    {0xC3B8358109E84F07ULL, 0x0A862F80EC4700C8ULL}, // 5^297
+    {0xF4A642E14C6262C8ULL, 0xCD27BB612758C0FAULL}, // 5^298
+    {0x98E7E9CCCFBD7DBDULL, 0x8038D51CB897789CULL}, // 5^299
+    {0xBF21E44003ACDD2CULL, 0xE0470A63E6BD56C3ULL}, // 5^300
+    {0xEEEA5D5004981478ULL, 0x1858CCFCE06CAC74ULL}, // 5^301
+    {0x95527A5202DF0CCBULL, 0x0F37801E0C43EBC8ULL}, // 5^302
+    {0xBAA718E68396CFFDULL, 0xD30560258F54E6BAULL}, // 5^303
+    {0xE950DF20247C83FDULL, 0x47C6B82EF32A2069ULL}, // 5^304
+    {0x91D28B7416CDD27EULL, 0x4CDC331D57FA5441ULL}, // 5^305
+    {0xB6472E511C81471DULL, 0xE0133FE4ADF8E952ULL}, // 5^306
+    {0xE3D8F9E563A198E5ULL, 0x58180FDDD97723A6ULL}, // 5^307
+    {0x8E679C2F5E44FF8FULL, 0x570F09EAA7EA7648ULL}, // 5^308
+};
+
+/// @brief 64×64位乘法
+/// @param lo 存放128位乘积的低64位
+/// @return 128位乘积的高64位
+static inline uint64_t qio_mul64(uint64_t a, uint64_t b, uint64_t *lo)
 {
-    char c;
-    while ((c = getchar()) != '-' && !isdigit(c))
-        if (c == EOF)
-            return false;
-    bool neg = false;
-    if (c == '-')
-        *x = 0, neg = true;
-    else
-        *x = c & 15;
-    while (isdigit(c = getchar()))
-        *x = *x * 10 + (c & 15);
-    if (neg)
-        *x = -*x;
+#ifdef __SIZEOF_INT128__
+    QIOUInt128 p = (QIOUInt128)a * b;
+    *lo = (uint64_t)p;
+    return (uint64_t)(p >> 64);
+#else
+    // 没有128位整数的目标（如i386）上按32位分段相乘
+    uint64_t al = (uint32_t)a, ah = a >> 32, bl = (uint32_t)b, bh = b >> 32;
+    uint64_t ll = al * bl, lh = al * bh, hl = ah * bl, hh = ah * bh;
+    uint64_t mid = (ll >> 32) + (uint32_t)lh + (uint32_t)hl;
+    *lo = mid << 32 | (uint32_t)ll;
+    return hh + (lh >> 32) + (hl >> 32) + (mid >> 32);
+#endif
+}
+
+/// @brief Eisel-Lemire算法：用5^q的128位近似值把w×10^q正确舍入为double
+/// @param w 十进制尾数，不为0
+/// @param q 十进制指数
+/// @param bits 存放结果的位模式（不含符号）
+/// @note 只用两次64×64位乘法，不论尾数多长、指数多大；恰好位于两个double正中间的情况按向偶数舍入处理
+/// @return 能确定舍入结果时返回true；128位近似不足以确定时（极少见）返回false，由调用者退回精确的转换
+static bool qio_eisel_lemire(uint64_t w, int64_t q, uint64_t *bits)
+{
+    if (q < QIO_POW5_MIN)
+    {
+        *bits = 0;
+        return true;
+    }
+    if (q > QIO_POW5_MAX)
+    {
+        *bits = 0x7FF0000000000000ULL;
+        return true;
+    }
+    int lz = __builtin_clzll(w);
+    w <<= lz;
+    const uint64_t *p5 = pow5x128[q - QIO_POW5_MIN];
+    uint64_t lo, hi = qio_mul64(w, p5[0], &lo);
+    if ((hi & 0x1FF) == 0x1FF)
+    {
+        // 高64位中决定舍入的低9位全为1，可能受截断误差影响，补上5^q低64位的乘积
+        uint64_t unused, second = qio_mul64(w, p5[1], &unused);
+        lo += second;
+        if (second > lo)
+            ++hi;
+    }
+    if (lo == UINT64_MAX && (q < -27 || q > 55))
+        return false; // 5^q不能被128位精确表示时，乘积的误差可能跨过舍入边界
+    int upper = (int)(hi >> 63);
+    int shift = upper + 64 - 52 - 3;
+    uint64_t mantissa = hi >> shift; // 54或55位：尾数加上一位舍入位
+    int64_t power2 = ((217706 * q) >> 16) + 63 + upper - lz + 1023; // floor(q×log2(10)) + 63，再加上指数偏移
+    if (power2 <= 0)
+    {
+        // 非规格化数
+        if (-power2 + 1 >= 64)
+        {
+            *bits = 0;
+            return true;
+        }
+        mantissa >>= -power2 + 1;
+        mantissa += mantissa & 1;
+        *bits = mantissa >> 1; // 进位到2^52时恰好成为最小的规格化数
+        return true;
+    }
+    // 乘积恰好是舍入位为1、其余为0的整数时位于两个double正中间，向偶数舍入；只有q在[-4, 23]时才可能出现
+    if (lo <= 1 && q >= -4 && q <= 23 && (mantissa & 3) == 1 && (mantissa << shift) == hi)
+        mantissa &= ~(uint64_t)1;
+    mantissa += mantissa & 1;
+    mantissa >>= 1;
+    if (mantissa >= (2ULL << 52))
+    {
+        mantissa = 1ULL << 52;
+        ++power2;
+    }
+    mantissa &= ~(1ULL << 52);
+    *bits = power2 >= 0x7FF ? 0x7FF0000000000000ULL : mantissa | (uint64_t)power2 << 52;
     return true;
 }
 
-/// @brief 读正负浮点、零（也可以读整数）并且可以判断".14"这样的输入
+/// @brief 把十进制有效数字digits[0..n)×10^e10正确舍入为double
+/// @param mant digits的前19位组成的整数，为0说明没有有效数字
+/// @param exact mant是否就是全部有效数字
+/// @param sticky 超出digits的部分中是否有非零数字
+/// @note 尾数不超过2^53且10的幂能被精确表示时只需一次乘法或除法（结果由IEEE保证正确舍入）；
+///       其余情况用Eisel-Lemire算法，有效数字超过19位时对前19位mant和mant+1各算一次，两者一致即为结果；
+///       只有128位近似不足以确定舍入方向时才交给strtod
+static double qio_decimal_to_double(uint64_t mant, bool exact, int64_t e10, char *digits, size_t n, bool sticky)
+{
+#if FLT_EVAL_METHOD == 0
+    if (exact && mant <= (1ULL << 53))
+    {
+        if (e10 >= 0 && e10 <= 22)
+            return (double)mant * exactpow10[e10];
+        if (e10 < 0 && e10 >= -22)
+            return (double)mant / exactpow10[-e10];
+        // mant×10^(e10-22)仍是不超过2^53的整数时，拆成两次精确运算
+        if (e10 > 22 && e10 <= 22 + 15)
+        {
+            uint64_t m = mant;
+            for (int64_t i = 22; i < e10 && m <= (1ULL << 53); ++i)
+                m *= 10;
+            if (m <= (1ULL << 53))
+                return (double)m * exactpow10[22];
+        }
+    }
+#endif
+    if (mant == 0)
+        return 0.0;
+    int64_t q = n > 19 ? e10 + (int64_t)(n - 19) : e10; // 值约为mant×10^q
+    uint64_t lower, upper;
+    if (qio_eisel_lemire(mant, q, &lower) && (exact || (qio_eisel_lemire(mant + 1, q, &upper) && upper == lower)))
+    {
+        double v;
+        memcpy(&v, &lower, sizeof(v));
+        return v;
+    }
+    char *p = digits + n;
+    if (sticky)
+    {
+        *p++ = '1'; // 被截掉的非零数字，保证舍入方向正确
+        --e10;
+    }
+    if (e10 > 99999)
+        e10 = 99999;
+    if (e10 < -99999)
+        e10 = -99999;
+    sprintf(p, "e%d", (int)e10); // 只有数字和指数，不受locale的小数点影响
+    return strtod(digits, NULL);
+}
+
+/// @brief 从流中读正负浮点、零（也可以读整数）并且可以判断".14"和"1e-5"这样的输入
+/// @param this 指向目标流的指针
 /// @param x 存放读取的值
-/// @note -0.00这样的输入使得x=-0.000000
-void QIOGetDouble(double *x)
+/// @note -0.00这样的输入使得x=-0.000000；结果是输入的十进制数正确舍入后的double
+/// @return 若成功读到一个浮点数返回true，若读到EOF返回false
+bool QIOStreamGetDouble(QIOStream *this, double *x)
 {
-    char c;
-    while ((c = getchar()) != '-' && c != '.' && !isdigit(c))
-        ;
+    int c;
+    while ((c = qio_getc(this)) != '-' && c != '.' && !QIO_IS_DIGIT(c))
+        if (c == EOF)
+            return false;
     bool neg = false;
     if (c == '-')
     {
         neg = true;
-        c = getchar();
+        c = qio_getc(this);
     }
-    *x = 0;
-    if (c != '.')
+    char digits[QIO_MAX_DIGITS + 16]; // 有效数字，末尾留出粘滞位和指数的空间
+    size_t n = 0;
+    uint64_t mant = 0;   // 前19位有效数字
+    int64_t e10 = 0;     // 值为digits×10^e10
+    bool sticky = false; // 超出QIO_MAX_DIGITS的数字中是否有非零的
+    // 整数部分
+    for (; QIO_IS_DIGIT(c); c = qio_getc(this))
     {
-        // 整数部分
-        *x = c & 15;
-        while (isdigit(c = getchar()))
-            *x = *x * 10 + (c & 15);
+        if (n == 0 && c == '0')
+            continue; // 前导零
+        if (n < QIO_MAX_DIGITS)
+        {
+            if (n < 19)
+                mant = mant * 10 + (c & 15);
+            digits[n++] = c;
+        }
+        else
+        {
+            sticky |= c != '0';
+            ++e10;
+        }
     }
     if (c == '.')
     {
         // 小数部分
-        double ten = 1.0;
-        while (isdigit(c = getchar()))
-            *x += (c & 15) * (ten /= 10);
+        while (QIO_IS_DIGIT(c = qio_getc(this)))
+        {
+            if (n == 0 && c == '0')
+            {
+                --e10;
+                continue;
+            }
+            if (n < QIO_MAX_DIGITS)
+            {
+                if (n < 19)
+                    mant = mant * 10 + (c & 15);
+                digits[n++] = c;
+                --e10;
+            }
+            else
+                sticky |= c != '0';
+        }
+    }
+    if (c == 'e' || c == 'E')
+    {
+        // 指数部分，没有数字时忽略
+        bool eneg = false;
+        if ((c = qio_getc(this)) == '-' || c == '+')
+        {
+            eneg = c == '-';
+            c = qio_getc(this);
+        }
+        int64_t e = 0;
+        for (; QIO_IS_DIGIT(c); c = qio_getc(this))
+            if (e < 1000000)
+                e = e * 10 + (c & 15);
+        e10 += eneg ? -e : e;
+    }
+    double v = qio_decimal_to_double(mant, n <= 19 && !sticky, e10, digits, n, sticky);
+    *x = neg ? -v : v;
+    return true;
+}
+
+/// @brief 保证流式输入的缓冲区中至少有need个字节可读（读到EOF除外）
+/// @note 尚未读取的数据被移到缓冲区开头，因此跨越填充边界的数字仍然是连续的
+/// @return 能够填充返回true；映射模式、内存输入、getchar后备模式或缓冲区过小时返回false
+static bool qio_fill(QIOStream *this, size_t need)
+{
+    if (this->in.map != NULL || this->in.borrowed || this->in.fallback || this->in.buf == NULL || this->in.size < need)
+        return false;
+    size_t pending = this->in.end - this->in.cur;
+    memmove(this->in.buf, this->in.cur, pending);
+    this->in.cur = this->in.buf;
+    this->in.end = this->in.buf + pending;
+    while (!this->in.eof && (size_t)(this->in.end - this->in.cur) < need)
+    {
+        ssize_t n = qio_read_input(this, this->in.end, this->in.buf + this->in.size - this->in.end);
+        if (n <= 0)
+            this->in.eof = true;
+        else
+            this->in.end += n;
     }
-    if (neg)
-        *x = -*x;
+    return true;
 }
 
-/// @brief 输出整数
+/// 批量读取时每个数字起点之后至少要可见的字节数，保证向量加载不越界
+#define QIO_BATCH_WINDOW 64
+
+static inline const char *qio_skip_scalar(const char *p, const char *end)
+{
+    while (p < end && *p != '-' && !QIO_IS_DIGIT(*p))
+        ++p;
+    return p;
+}
+
+static inline size_t qio_run_scalar(const char *p, const char *end)
+{
+    const char *q = p;
+    while (q < end && QIO_IS_DIGIT(*q))
+        ++q;
+    return q - p;
+}
+
+/// @brief 逐个字符转换len个数字，用于没有足够字节做整块加载的情况
+static inline uint64_t qio_conv_scalar(const char *p, size_t len)
+{
+    uint64_t v = 0;
+    while (len--)
+        v = v * 10 + (*p++ & 15);
+    return v;
+}
+
+/// @brief 把p开始的len（1~8）个数字转成整数，要求p之后有8个字节可读
+static inline uint64_t qio_conv8(const char *p, size_t len)
+{
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__
+    // SWAR：一次处理8个字节，左移使数字右对齐，高位补0
+    uint64_t v;
+    memcpy(&v, p, 8);
+    v = (v & 0x0F0F0F0F0F0F0F0FULL) << (8 * (8 - len));
+    v = (v * 2561) >> 8;
+    v = ((v & 0x00FF00FF00FF00FFULL) * 6553601) >> 16;
+    return ((v & 0x0000FFFF0000FFFFULL) * 42949672960001ULL) >> 32;
+#else
+    return qio_conv_scalar(p, len);
+#endif
+}
+
+/// @brief 把p开始的len（1~16）个数字转成整数，要求p之后有16个字节可读
+static inline uint64_t qio_conv16_swar(const char *p, size_t len)
+{
+    if (len <= 8)
+        return qio_conv8(p, len);
+    return qio_conv8(p, len - 8) * 100000000ULL + qio_conv8(p + len - 8, 8);
+}
+
+/// @brief 定义一个批量读整数的内核
+/// @param NAME 生成的函数名
+/// @param ATTR 函数属性（指令集）
+/// @param SKIP 跳过分隔符的函数，返回第一个'-'或数字的位置
+/// @param RUN 返回连续数字个数的函数
+/// @param CONV16 把1~16个数字转成整数的函数，要求之后有16个字节可读
+#define QIO_DEFINE_BATCH(NAME, ATTR, SKIP, RUN, CONV16)                                           \
+    ATTR static size_t NAME(QIOStream *this, void *out, bool wide, size_t n)                      \
+    {                                                                                             \
+        size_t got = 0;                                                                           \
+        while (got < n)                                                                           \
+        {                                                                                         \
+            const char *p = SKIP(this->in.cur, this->in.end), *end = this->in.end;                \
+            int64_t v = 0;                                                                        \
+            if (end - p < QIO_BATCH_WINDOW && !this->in.eof)                                      \
+            {                                                                                     \
+                /* 窗口不足：先补充数据，无法补充时逐字节读取 */                                  \
+                this->in.cur = (char *)p;                                                         \
+                if (qio_fill(this, QIO_BATCH_WINDOW))                                             \
+                    continue;                                                                     \
+                if (!QIOStreamGetI64(this, &v))                                                   \
+                    break;                                                                        \
+            }                                                                                     \
+            else if (p == end)                                                                    \
+            {                                                                                     \
+                this->in.cur = (char *)p;                                                         \
+                break;                                                                            \
+            }                                                                                     \
+            else                                                                                  \
+            {                                                                                     \
+                bool neg = *p == '-';                                                             \
+                const char *d = p + neg;                                                          \
+                size_t len = RUN(d, end);                                                         \
+                if (len == 0 || len > 19)                                                         \
+                {                                                                                 \
+                    /* 单独的'-'和超出64位的数字按原样逐字节读取（分别得到0和溢出回绕的值） */    \
+                    this->in.cur = (char *)p;                                                     \
+                    QIOStreamGetI64(this, &v);                                                    \
+                }                                                                                 \
+                else                                                                              \
+                {                                                                                 \
+                    uint64_t u;                                                                   \
+                    if (end - d < 16) /* 文件末尾不够一次整块加载 */                              \
+                        u = qio_conv_scalar(d, len);                                              \
+                    else if (len <= 16)                                                           \
+                        u = CONV16(d, len);                                                       \
+                    else                                                                          \
+                        u = qio_conv_scalar(d, len - 16) * 10000000000000000ULL +                 \
+                            CONV16(d + len - 16, 16);                                             \
+                    v = (int64_t)(neg ? 0 - u : u);                                               \
+                    d += len;                                                                     \
+                    this->in.cur = (char *)(d < end ? d + 1 : d); /* 与QIOGetInt一样吃掉结束符 */ \
+                }                                                                                 \
+            }                                                                                     \
+            if (wide)                                                                             \
+                ((int64_t *)out)[got++] = v;                                                      \
+            else                                                                                  \
+                ((int *)out)[got++] = (int)v;                                                     \
+        }                                                                                         \
+        return got;                                                                               \
+    }
+
+QIO_DEFINE_BATCH(qio_batch_scalar, , qio_skip_scalar, qio_run_scalar, qio_conv16_swar)
+
+#ifdef QIO_X86_SIMD
+/// @brief 用16字节比较找到第一个'-'或数字
+__attribute__((target("sse2"))) static inline const char *qio_skip_sse2(const char *p, const char *end)
+{
+    const __m128i zero = _mm_set1_epi8('0'), nine = _mm_set1_epi8(9), minus = _mm_set1_epi8('-');
+    while (end - p >= 16)
+    {
+        __m128i c = _mm_loadu_si128((const __m128i *)p);
+        __m128i x = _mm_sub_epi8(c, zero);
+        __m128i hit = _mm_or_si128(_mm_cmpeq_epi8(_mm_min_epu8(x, nine), x), _mm_cmpeq_epi8(c, minus));
+        unsigned m = _mm_movemask_epi8(hit);
+        if (m)
+            return p + __builtin_ctz(m);
+        p += 16;
+    }
+    return qio_skip_scalar(p, end);
+}
+
+/// @brief 用16字节比较求连续数字的个数
+__attribute__((target("sse2"))) static inline size_t qio_run_sse2(const char *p, const char *end)
+{
+    const char *q = p;
+    const __m128i zero = _mm_set1_epi8('0'), nine = _mm_set1_epi8(9);
+    while (end - q >= 16)
+    {
+        __m128i x = _mm_sub_epi8(_mm_loadu_si128((const __m128i *)q), zero);
+        unsigned m = ~_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_min_epu8(x, nine), x)) & 0xFFFF;
+        if (m)
+            return q - p + __builtin_ctz(m);
+        q += 16;
+    }
+    return q - p + qio_run_scalar(q, end);
+}
+
+/// @brief 用32字节比较找到第一个'-'或数字
+__attribute__((target("avx2"))) static inline const char *qio_skip_avx2(const char *p, const char *end)
+{
+    const __m256i zero = _mm256_set1_epi8('0'), nine = _mm256_set1_epi8(9), minus = _mm256_set1_epi8('-');
+    while (end - p >= 32)
+    {
+        __m256i c = _mm256_loadu_si256((const __m256i *)p);
+        __m256i x = _mm256_sub_epi8(c, zero);
+        __m256i hit = _mm256_or_si256(_mm256_cmpeq_epi8(_mm256_min_epu8(x, nine), x), _mm256_cmpeq_epi8(c, minus));
+        unsigned m = _mm256_movemask_epi8(hit);
+        if (m)
+            return p + __builtin_ctz(m);
+        p += 32;
+    }
+    return qio_skip_scalar(p, end);
+}
+
+/// @brief 用32字节比较求连续数字的个数
+__attribute__((target("avx2"))) static inline size_t qio_run_avx2(const char *p, const char *end)
+{
+    const char *q = p;
+    const __m256i zero = _mm256_set1_epi8('0'), nine = _mm256_set1_epi8(9);
+    while (end - q >= 32)
+    {
+        __m256i x = _mm256_sub_epi8(_mm256_loadu_si256((const __m256i *)q), zero);
+        unsigned m = ~(unsigned)_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_min_epu8(x, nine), x));
+        if (m)
+            return q - p + __builtin_ctz(m);
+        q += 32;
+    }
+    return q - p + qio_run_scalar(q, end);
+}
+
+/// @brief 把p开始的len（1~16）个数字一次转成整数，要求p之后有16个字节可读
+/// @note 先用pshufb把数字右对齐（高位补0），再逐级做乘加：1位->2位->4位->8位
+__attribute__((target("sse4.1"))) static inline uint64_t qio_conv16_sse41(const char *p, size_t len)
+{
+    static const int8_t shift[32] = {-1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1,
+                                     0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15};
+    __m128i c = _mm_sub_epi8(_mm_loadu_si128((const __m128i *)p), _mm_set1_epi8('0'));
+    c = _mm_shuffle_epi8(c, _mm_loadu_si128((const __m128i *)(shift + len)));
+    __m128i m1 = _mm_maddubs_epi16(c, _mm_set_epi8(1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10, 1, 10));
+    __m128i m2 = _mm_madd_epi16(m1, _mm_set_epi16(1, 100, 1, 100, 1, 100, 1, 100));
+    __m128i m3 = _mm_packus_epi32(m2, m2);
+    __m128i m4 = _mm_madd_epi16(m3, _mm_set_epi16(1, 10000, 1, 10000, 1, 10000, 1, 10000));
+    uint64_t hi = (uint32_t)_mm_cvtsi128_si32(m4), lo = (uint32_t)_mm_extract_epi32(m4, 1);
+    return hi * 100000000ULL + lo;
+}
+
+QIO_DEFINE_BATCH(qio_batch_sse41, __attribute__((target("sse4.1"))), qio_skip_sse2, qio_run_sse2, qio_conv16_sse41)
+QIO_DEFINE_BATCH(qio_batch_avx2, __attribute__((target("avx2"))), qio_skip_avx2, qio_run_avx2, qio_conv16_sse41)
+#endif
+
+typedef size_t (*QIOBatchFn)(QIOStream *this, void *out, bool wide, size_t n);
+
+/// @brief 按CPU支持的指令集选择批量读取内核，结果只计算一次
+static QIOBatchFn qio_batch_kernel(void)
+{
+    static QIOBatchFn cached = NULL;
+    QIOBatchFn kernel = __atomic_load_n(&cached, __ATOMIC_RELAXED);
+    if (kernel == NULL)
+    {
+        kernel = qio_batch_scalar;
+#ifdef QIO_X86_SIMD
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx2"))
+            kernel = qio_batch_avx2;
+        else if (__builtin_cpu_supports("sse4.1"))
+            kernel = qio_batch_sse41;
+#endif
+        __atomic_store_n(&cached, kernel, __ATOMIC_RELAXED); // 各线程算出的结果相同，重复写入无妨
+    }
+    return kernel;
+}
+
+/// @brief 从流中批量读整数，适合"先读N，再读N个整数"这样的输入
+/// @param this 指向目标流的指针
+/// @param out 存放读取结果的数组，至少能容纳n个元素
+/// @param n 期望读取的个数
+/// @note 按CPU在运行时选择AVX2/SSE4.1/标量内核，一次定位数字边界并把最多16位数字整块转换；
+///       分隔符的规则与QIOGetInt相同（'-'和数字以外的字符都视为分隔符）
+/// @return 实际读到的个数，小于n说明遇到了EOF
+size_t QIOStreamGetIntArray(QIOStream *this, int *out, size_t n)
+{
+    if (!this->in.inited)
+        qio_input_init(this);
+    return qio_batch_kernel()(this, out, false, n);
+}
+
+/// @brief 从流中批量读64位整数，用法与QIOStreamGetIntArray相同
+/// @param this 指向目标流的指针
+/// @param out 存放读取结果的数组，至少能容纳n个元素
+/// @param n 期望读取的个数
+/// @return 实际读到的个数，小于n说明遇到了EOF
+size_t QIOStreamGetI64Array(QIOStream *this, int64_t *out, size_t n)
+{
+    if (!this->in.inited)
+        qio_input_init(this);
+    return qio_batch_kernel()(this, out, true, n);
+}
+
+/// 两位一组的数字表，整数格式化时每次除以100查表写出两个字符
+static const char digitpairs[201] =
+    "00010203040506070809"
+    "10111213141516171819"
+    "20212223242526272829"
+    "30313233343536373839"
+    "40414243444546474849"
+    "50515253545556575859"
+    "60616263646566676869"
+    "70717273747576777879"
+    "80818283848586878889"
+    "90919293949596979899";
+
+/// 输出缓冲区分配失败时使用的后备缓冲区
+static char outputfallback[QIO_MIN_OUTPUT_BUFFER_SIZE];
+
+static void qio_flush_at_exit(void)
+{
+    QIOStreamFlush(&qio_stdio);
+}
+
+/// @brief 初始化输出缓冲区，默认stdio流还会注册退出时的自动刷新
+/// @return 成功返回true；默认stdio流分配失败时改用后备缓冲区，其他流返回false
+static bool qio_output_init(QIOStream *this)
+{
+    this->out.buf = (char *)malloc(this->out.size);
+    if (this->out.buf == NULL)
+    {
+        fprintf(stderr, "Memory allocation failed for QuickIO output buffer.\n");
+        if (this != &qio_stdio)
+            return false;
+        this->out.buf = outputfallback;
+        this->out.size = sizeof(outputfallback);
+    }
+    this->out.cur = this->out.mark = this->out.buf;
+    this->out.end = this->out.buf + this->out.size;
+    if (this == &qio_stdio)
+        atexit(qio_flush_at_exit);
+    return true;
+}
+
+/// @brief 把iov中登记的所有数据段写出，处理被信号打断和部分写入的情况
+/// @return 全部写出返回true，出错返回false（未写出的数据被丢弃）
+static bool qio_write_iov(QIOStream *this, struct iovec *iov, int cnt)
+{
+    while (cnt > 0)
+    {
+        ssize_t n = cnt == 1 ? write(this->out.fd, iov->iov_base, iov->iov_len) : writev(this->out.fd, iov, cnt);
+        if (n < 0)
+        {
+            if (errno == EINTR)
+                continue;
+            fprintf(stderr, "QuickIO write failed.\n");
+            return false;
+        }
+        // 跳过已经完整写出的段，再调整写了一半的段
+        while (cnt > 0 && (size_t)n >= iov->iov_len)
+        {
+            n -= iov->iov_len;
+            ++iov, --cnt;
+        }
+        if (cnt > 0)
+        {
+            iov->iov_base = (char *)iov->iov_base + n;
+            iov->iov_len -= n;
+        }
+    }
+    return true;
+}
+
+/// @brief 把流的输出缓冲区以及通过QIOStreamPutSpan()登记的数据段全部写出
+/// @param this 指向目标流的指针
+/// @note 输出到stdout时会先fflush(stdout)，使此前用printf等输出的内容排在前面；默认stdio流在程序正常退出时会自动刷新
+/// @return 全部写出返回true，写入出错返回false
+bool QIOStreamFlush(QIOStream *this)
+{
+    if (this->out.buf == NULL)
+        return true;
+    if (this->out.cur > this->out.mark)
+    {
+        this->out.iov[this->out.iovcnt].iov_base = this->out.mark;
+        this->out.iov[this->out.iovcnt].iov_len = this->out.cur - this->out.mark;
+        ++this->out.iovcnt;
+    }
+    bool ok = true;
+    if (this->out.iovcnt)
+    {
+        if (this->out.fd == STDOUT_FILENO)
+            fflush(stdout);
+        ok = qio_write_iov(this, this->out.iov, this->out.iovcnt);
+    }
+    this->out.cur = this->out.mark = this->out.buf;
+    this->out.iovcnt = 0;
+    return ok;
+}
+
+/// @brief 设置输出缓冲区的大小
+/// @param this 指向目标流的指针
+/// @param size 新的缓冲区容量（字节），为0时使用默认值，小于QIO_MIN_OUTPUT_BUFFER_SIZE时按最小值处理
+/// @note 会先刷新已有的输出
+/// @return 成功返回true；内存分配失败时保持原缓冲区不变并返回false
+bool QIOStreamSetOutputBufferSize(QIOStream *this, size_t size)
+{
+    if (size == 0)
+        size = QIO_DEFAULT_BUFFER_SIZE;
+    if (size < QIO_MIN_OUTPUT_BUFFER_SIZE)
+        size = QIO_MIN_OUTPUT_BUFFER_SIZE;
+    if (this->out.buf == NULL)
+    {
+        this->out.size = size;
+        return true;
+    }
+    QIOStreamFlush(this);
+    char *buf = (char *)malloc(size);
+    if (buf == NULL)
+    {
+        fprintf(stderr, "Memory allocation failed for QuickIO output buffer.\n");
+        return false;
+    }
+    if (this->out.buf != outputfallback)
+        free(this->out.buf);
+    this->out.buf = this->out.cur = this->out.mark = buf;
+    this->out.end = buf + size;
+    this->out.size = size;
+    return true;
+}
+
+/// @brief 确保输出缓冲区至少还有n个字节的空间（n不超过QIO_MIN_OUTPUT_BUFFER_SIZE）
+/// @return 可以写入的位置
+static inline char *qio_reserve(QIOStream *this, size_t n)
+{
+    if ((size_t)(this->out.end - this->out.cur) < n)
+    {
+        if (this->out.buf == NULL)
+        {
+            if (!qio_output_init(this))
+            {
+                perror("QuickIO输出缓冲区不可用");
+                exit(EXIT_FAILURE);
+            }
+        }
+        else
+            QIOStreamFlush(this);
+    }
+    return this->out.cur;
+}
+
+static inline void qio_putc(QIOStream *this, char c)
+{
+    *qio_reserve(this, 1) = c;
+    ++this->out.cur;
+}
+
+/// @brief 把一段数据复制进输出缓冲区，数据较长时分块写入
+static void qio_write(QIOStream *this, const char *data, size_t len)
+{
+    while (len)
+    {
+        char *p = qio_reserve(this, 1);
+        size_t n = this->out.end - p;
+        if (n > len)
+            n = len;
+        memcpy(p, data, n);
+        this->out.cur += n;
+        data += n, len -= n;
+    }
+}
+
+/// @brief 向流输出一段外部数据
+/// @param this 指向目标流的指针
+/// @param data 数据起始地址
+/// @param len 数据长度（字节）
+/// @note 较长的数据不会被复制，而是登记为一个iov段，在下一次刷新时与缓冲区中的内容一起用writev()写出，
+///       因此在下一次QIOStreamFlush()返回之前data必须保持有效且不被修改
+void QIOStreamPutSpan(QIOStream *this, const void *data, size_t len)
+{
+    if (len < QIO_SPAN_COPY_THRESHOLD)
+    {
+        qio_write(this, (const char *)data, len);
+        return;
+    }
+    if (this->out.buf == NULL)
+        qio_reserve(this, 1); // 完成缓冲区的初始化
+    if (this->out.iovcnt + 2 > QIO_MAX_SPANS * 2)
+        QIOStreamFlush(this);
+    if (this->out.cur > this->out.mark)
+    {
+        this->out.iov[this->out.iovcnt].iov_base = this->out.mark;
+        this->out.iov[this->out.iovcnt].iov_len = this->out.cur - this->out.mark;
+        ++this->out.iovcnt;
+        this->out.mark = this->out.cur;
+    }
+    this->out.iov[this->out.iovcnt].iov_base = (void *)data;
+    this->out.iov[this->out.iovcnt].iov_len = len;
+    ++this->out.iovcnt;
+}
+
+/// @brief 计算无符号整数的十进制位数
+static inline int qio_digits_u64(uint64_t x)
+{
+    int n = 1;
+    for (;;)
+    {
+        if (x < 10)
+            return n;
+        if (x < 100)
+            return n + 1;
+        if (x < 1000)
+            return n + 2;
+        if (x < 10000)
+            return n + 3;
+        x /= 10000;
+        n += 4;
+    }
+}
+
+/// @brief 把x的低n位十进制数字（不足补0）写到p处，从低位向高位每次写两位
+/// @return 写完后的位置
+static inline char *qio_format_digits(char *p, uint64_t x, int n)
+{
+    char *q = p + n;
+    while (q - p >= 2)
+    {
+        q -= 2;
+        memcpy(q, digitpairs + (x % 100) * 2, 2);
+        x /= 100;
+    }
+    if (q > p)
+        *p = '0' + x % 10;
+    return p + n;
+}
+
+/// @brief 把无符号整数格式化到p处
+/// @return 写完后的位置
+static inline char *qio_format_u64(char *p, uint64_t x)
+{
+    return qio_format_digits(p, x, qio_digits_u64(x));
+}
+
+#ifdef __SIZEOF_INT128__
+/// @brief 把128位无符号整数格式化到p处，按10^19分段后复用64位的格式化
+/// @return 写完后的位置
+static char *qio_format_u128(char *p, QIOUInt128 x)
+{
+    static const uint64_t chunkscale = 10000000000000000000ULL; // 10^19
+    if (x >> 64 == 0)
+        return qio_format_u64(p, (uint64_t)x);
+    p = qio_format_u128(p, x / chunkscale);
+    return qio_format_digits(p, (uint64_t)(x % chunkscale), 19);
+}
+#endif
+
+/// @brief 定义一个有符号整数写函数
+/// @param NAME 函数名
+/// @param T 参数类型
+/// @param UT 与T等宽的无符号类型，取负在其上进行，因此最小值不会溢出
+/// @param FORMAT 无符号格式化函数
+/// @param MAXLEN 最长的输出长度（含负号）
+#define QIO_DEFINE_PUT_SIGNED(NAME, T, UT, FORMAT, MAXLEN) \
+    void NAME(QIOStream *this, T x)                       \
+    {                                                     \
+        char *p = qio_reserve(this, MAXLEN);              \
+        UT u = (UT)x;                                     \
+        if (x < 0)                                        \
+        {                                                 \
+            *p++ = '-';                                   \
+            u = (UT)0 - u;                                \
+        }                                                 \
+        this->out.cur = FORMAT(p, u);                     \
+    }
+
+/// @brief 向流输出整数
+/// @param this 指向目标流的指针
 /// @param x 要输出的整数
-void QIOPutInt(int x)
+QIO_DEFINE_PUT_SIGNED(QIOStreamPutInt, int, unsigned, qio_format_u64, 11)
+
+/// @brief 向流输出64位整数
+QIO_DEFINE_PUT_SIGNED(QIOStreamPutI64, int64_t, uint64_t, qio_format_u64, 20)
+
+#ifdef __SIZEOF_INT128__
+/// @brief 向流输出128位整数
+QIO_DEFINE_PUT_SIGNED(QIOStreamPutI128, QIOInt128, QIOUInt128, qio_format_u128, 40)
+#endif
+
+/// @brief 向流输出64位无符号整数
+void QIOStreamPutU64(QIOStream *this, uint64_t x)
 {
-    if (x == 0)
-        putchar('0');
+    this->out.cur = qio_format_u64(qio_reserve(this, 20), x);
+}
+
+#ifdef __SIZEOF_INT128__
+/// @brief 向流输出128位无符号整数
+void QIOStreamPutU128(QIOStream *this, QIOUInt128 x)
+{
+    this->out.cur = qio_format_u128(qio_reserve(this, 39), x);
+}
+#endif
+
+/// @brief 输出一个不含'\0'的短字符串
+static void qio_puts(QIOStream *this, const char *s)
+{
+    qio_write(this, s, strlen(s));
+}
+
+/// 小数点后的位数超过1074时，double的十进制展开之后全是0
+#define QIO_MAX_FRAC_DIGITS 1074
+
+/// 定点格式化的大整数：m×10^precision最多约3621位，m×2^e最多1024位
+#define QIO_BIGNUM_WORDS 120
+
+/// 小端存放的无符号大整数，只支持定点格式化需要的几种运算
+typedef struct QIOBignum
+{
+    uint32_t w[QIO_BIGNUM_WORDS];
+    int n; ///< 有效的字数
+} QIOBignum;
+
+static void qio_big_set(QIOBignum *b, uint64_t v)
+{
+    b->w[0] = (uint32_t)v;
+    b->w[1] = (uint32_t)(v >> 32);
+    b->n = b->w[1] ? 2 : b->w[0] ? 1 : 0;
+}
+
+static void qio_big_mul(QIOBignum *b, uint32_t k)
+{
+    uint64_t carry = 0;
+    for (int i = 0; i < b->n; ++i)
+    {
+        uint64_t t = (uint64_t)b->w[i] * k + carry;
+        b->w[i] = (uint32_t)t;
+        carry = t >> 32;
+    }
+    if (carry)
+        b->w[b->n++] = (uint32_t)carry;
+}
+
+static void qio_big_shl(QIOBignum *b, int s)
+{
+    int words = s / 32, bits = s % 32;
+    if (b->n == 0)
+        return;
+    b->w[b->n] = 0;
+    for (int i = b->n; i >= 0; --i)
+    {
+        uint32_t hi = b->w[i] << bits;
+        uint32_t lo = (bits && i > 0) ? b->w[i - 1] >> (32 - bits) : 0;
+        b->w[i + words] = hi | lo;
+    }
+    for (int i = 0; i < words; ++i)
+        b->w[i] = 0;
+    b->n += words + 1;
+    while (b->n && b->w[b->n - 1] == 0)
+        --b->n;
+}
+
+/// @brief 右移s（s>=1）位并四舍五入（看被移出的最高位）
+static void qio_big_shr_round(QIOBignum *b, int s)
+{
+    int words = s / 32, bits = s % 32;
+    int hb = s - 1; // 被移出部分的最高位
+    bool up = hb / 32 < b->n && (b->w[hb / 32] >> (hb % 32) & 1);
+    if (words >= b->n)
+    {
+        qio_big_set(b, up);
+        return;
+    }
+    for (int i = 0; i + words < b->n; ++i)
+    {
+        uint32_t lo = b->w[i + words] >> bits;
+        uint32_t hi = (bits && i + words + 1 < b->n) ? b->w[i + words + 1] << (32 - bits) : 0;
+        b->w[i] = lo | hi;
+    }
+    b->n -= words;
+    while (b->n && b->w[b->n - 1] == 0)
+        --b->n;
+    for (int i = 0; up; ++i)
+    {
+        if (i == b->n)
+            b->w[b->n++] = 0;
+        up = ++b->w[i] == 0;
+    }
+}
+
+/// @brief 除以d，返回余数
+static uint32_t qio_big_divmod(QIOBignum *b, uint32_t d)
+{
+    uint64_t rem = 0;
+    for (int i = b->n - 1; i >= 0; --i)
+    {
+        uint64_t t = rem << 32 | b->w[i];
+        b->w[i] = (uint32_t)(t / d);
+        rem = t % d;
+    }
+    while (b->n && b->w[b->n - 1] == 0)
+        --b->n;
+    return (uint32_t)rem;
+}
+
+/// @brief 把大整数转成十进制数字串
+/// @return 数字个数（0输出为"0"）
+static size_t qio_big_to_digits(QIOBignum *b, char *out)
+{
+    uint32_t chunks[QIO_BIGNUM_WORDS * 10 / 9 + 2];
+    int k = 0;
+    do
+        chunks[k++] = qio_big_divmod(b, 1000000000u);
+    while (b->n);
+    char *p = qio_format_u64(out, chunks[--k]);
+    while (k--)
+        p = qio_format_digits(p, chunks[k], 9);
+    return p - out;
+}
+
+/// @brief 输出整数digits[0..len)除以10^precision的定点表示，整数部分为0时补一个0
+static void qio_put_scaled(QIOStream *this, const char *digits, size_t len, int precision)
+{
+    if (len > (size_t)precision)
+    {
+        qio_write(this, digits, len - precision);
+        digits += len - precision;
+        len = precision;
+    }
+    else
+        qio_putc(this, '0');
+    if (precision == 0)
+        return;
+    qio_putc(this, '.');
+    for (size_t i = len; i < (size_t)precision; ++i)
+        qio_putc(this, '0');
+    qio_write(this, digits, len);
+}
+
+static const uint64_t pow10u64[20] = {1ULL, 10ULL, 100ULL, 1000ULL, 10000ULL, 100000ULL, 1000000ULL, 10000000ULL,
+                                      100000000ULL, 1000000000ULL, 10000000000ULL, 100000000000ULL,
+                                      1000000000000ULL, 10000000000000ULL, 100000000000000ULL,
+                                      1000000000000000ULL, 10000000000000000ULL, 100000000000000000ULL,
+                                      1000000000000000000ULL, 10000000000000000000ULL};
+
+/// @brief 把double拆成m×2^e，m为整数（非规格化数同样适用）
+static void qio_decompose(double x, uint64_t *m, int *e)
+{
+    uint64_t bits;
+    memcpy(&bits, &x, 8);
+    uint64_t frac = bits & ((1ULL << 52) - 1);
+    int exp = (int)(bits >> 52 & 0x7FF);
+    if (exp == 0)
+        *m = frac, *e = 1 - 1075;
+    else
+        *m = frac | 1ULL << 52, *e = exp - 1075;
+}
+
+/// @brief 向流输出精度为precision的浮点数(四舍五入)
+/// @param this 指向目标流的指针
+/// @param precision 精度（小数点后的位数）
+/// @param x 要输出的浮点数
+/// @note 对-0.0输出-0.000000 如果precision为0，则只输出离x最近的整数；inf和nan输出为"inf"、"nan"。
+///       按x的精确二进制值舍入，覆盖double的全部范围和任意精度：常见情况用128位整数一次算出，
+///       超出范围（或目标不支持128位整数）时退回大整数运算
+void QIOStreamPutDouble(QIOStream *this, int precision, double x)
+{
+    if (signbit(x)) // from <math.h>, return true if the sign of x is negative（就相当于返回x的符号位）
+    {
+        x = -x;
+        qio_putc(this, '-');
+    }
+    if (isnan(x))
+    {
+        qio_puts(this, "nan");
+        return;
+    }
+    if (isinf(x))
+    {
+        qio_puts(this, "inf");
+        return;
+    }
+    if (precision < 0)
+        precision = 0;
+    int p = precision > QIO_MAX_FRAC_DIGITS ? QIO_MAX_FRAC_DIGITS : precision;
+    uint64_t m;
+    int e;
+    qio_decompose(x, &m, &e);
+    if (m)
+    {
+        int tz = __builtin_ctzll(m); // 去掉尾部的0，减少移位量
+        m >>= tz;
+        e += tz;
+    }
+    if (m == 0 || (e >= 0 && e <= __builtin_clzll(m)))
+    {
+        // 整数，直接输出
+        char *q = qio_reserve(this, 21);
+        this->out.cur = qio_format_u64(q, m << (m ? e : 0));
+        if (precision)
+            qio_putc(this, '.');
+        for (int i = 0; i < precision; ++i)
+            qio_putc(this, '0');
+        return;
+    }
+#ifdef __SIZEOF_INT128__
+    if (e < 0 && p <= 19)
+    {
+        // m×10^p < 2^117，用128位整数精确计算x×10^p并舍入
+        char small[48];
+        QIOUInt128 n = (QIOUInt128)m * pow10u64[p], r = 0;
+        int s = -e;
+        if (s <= 117)
+            r = (n >> s) + (n >> (s - 1) & 1);
+        qio_put_scaled(this, small, qio_format_u128(small, r) - small, p);
+    }
     else
+#endif
     {
-        if (x < 0)
+        QIOBignum b;
+        char digits[QIO_BIGNUM_WORDS * 10];
+        qio_big_set(&b, m);
+        if (e >= 0)
         {
-            x = -x;
-            putchar('-');
+            qio_big_shl(&b, e);
+            p = 0;
         }
-        int p = 0;
-        while (x)
+        else
         {
-            outputbuf[p++] = x % 10;
-            x /= 10;
+            for (int k = p; k > 0; k -= 9)
+                qio_big_mul(&b, (uint32_t)pow10u64[k < 9 ? k : 9]);
+            qio_big_shr_round(&b, -e);
         }
-        for (int i = p - 1; i >= 0; i--)
-            putchar('0' + outputbuf[i]); // 逆序输出
+        qio_put_scaled(this, digits, qio_big_to_digits(&b, digits), p);
+        if (precision && p == 0)
+            qio_putc(this, '.');
     }
+    for (int i = p; i < precision; ++i)
+        qio_putc(this, '0');
 }
 
-static void unsigned_output(int x)
+/// Grisu2中使用的"自定义浮点数"：值为f×2^e
+typedef struct QIODiyFp
 {
-    if (x == 0)
-        putchar('0');
-    else
+    uint64_t f;
+    int e;
+} QIODiyFp;
+
+/// 10^k的64位规格化近似值（四舍五入），k从-300到324，步长为8
+static const struct
+{
+    uint64_t f;
+    int e;
+    int k;
+} cachedpowers[] = {
+    {0xAB70FE17C79AC6CAULL, -1060, -300},
+    {0xFF77B1FCBEBCDC4FULL, -1034, -292},
+    {0xBE5691EF416BD60CULL, -1007, -284},
+    {0x8DD01FAD907FFC3CULL, -980, -276},
+    {0xD3515C2831559A83ULL, -954, -268},
+    {0x9D71AC8FADA6C9B5ULL, -927, -260},
+    {0xEA9C227723EE8BCBULL, -901, -252},
+    {0xAECC49914078536DULL, -874, -244},
+    {0x823C12795DB6CE57ULL, -847, -236},
+    {0xC21094364DFB5637ULL, -821, -228},
+    {0x9096EA6F3848984FULL, -794, -220},
+    {0xD77485CB25823AC7ULL, -768, -212},
+    {0xA086CFCD97BF97F4ULL, -741, -204},
+    {0xEF340A98172AACE5ULL, -715, -196},
+    {0xB23867FB2A35B28EULL, -688, -188},
+    {0x84C8D4DFD2C63F3BULL, -661, -180},
+    {0xC5DD44271AD3CDBAULL, -635, -172},
+    {0x936B9FCEBB25C996ULL, -608, -164},
+    {0xDBAC6C247D62A584ULL, -582, -156},
+    {0xA3AB66580D5FDAF6ULL, -555, -148},
+    {0xF3E2F893DEC3F126ULL, -529, -140},
+    {0xB5B5ADA8AAFF80B8ULL, -502, -132},
+    {0x87625F056C7C4A8BULL, -475, -124},
+    {0xC9BCFF6034C13053ULL, -449, -116},
+    {0x964E858C91BA2655ULL, -422, -108},
+    {0xDFF9772470297EBDULL, -396, -100},
+    {0xA6DFBD9FB8E5B88FULL, -369, -92},
+    {0xF8A95FCF88747D94ULL, -343, -84},
+    {0xB94470938FA89BCFULL, -316, -76},
+    {0x8A08F0F8BF0F156BULL, -289, -68},
+    {0xCDB02555653131B6ULL, -263, -60},
+    {0x993FE2C6D07B7FACULL, -236, -52},
+    {0xE45C10C42A2B3B06ULL, -210, -44},
+    {0xAA242499697392D3ULL, -183, -36},
+    {0xFD87B5F28300CA0EULL, -157, -28},
+    {0xBCE5086492111AEBULL, -130, -20},
+    {0x8CBCCC096F5088CCULL, -103, -12},
+    {0xD1B71758E219652CULL, -77, -4},
+    {0x9C40000000000000ULL, -50, 4},
+    {0xE8D4A51000000000ULL, -24, 12},
+    {0xAD78EBC5AC620000ULL, 3, 20},
+    {0x813F3978F8940984ULL, 30, 28},
+    {0xC097CE7BC90715B3ULL, 56, 36},
+    {0x8F7E32CE7BEA5C70ULL, 83, 44},
+    {0xD5D238A4ABE98068ULL, 109, 52},
+    {0x9F4F2726179A2245ULL, 136, 60},
+    {0xED63A231D4C4FB27ULL, 162, 68},
+    {0xB0DE65388CC8ADA8ULL, 189, 76},
+    {0x83C7088E1AAB65DBULL, 216, 84},
+    {0xC45D1DF942711D9AULL, 242, 92},
+    {0x924D692CA61BE758ULL, 269, 100},
+    {0xDA01EE641A708DEAULL, 295, 108},
+    {0xA26DA3999AEF774AULL, 322, 116},
+    {0xF209787BB47D6B85ULL, 348, 124},
+    {0xB454E4A179DD1877ULL, 375, 132},
+    {0x865B86925B9BC5C2ULL, 402, 140},
+    {0xC83553C5C8965D3DULL, 428, 148},
+    {0x952AB45CFA97A0B3ULL, 455, 156},
+    {0xDE469FBD99A05FE3ULL, 481, 164},
+    {0xA59BC234DB398C25ULL, 508, 172},
+    {0xF6C69A72A3989F5CULL, 534, 180},
+    {0xB7DCBF5354E9BECEULL, 561, 188},
+    {0x88FCF317F22241E2ULL, 588, 196},
+    {0xCC20CE9BD35C78A5ULL, 614, 204},
+    {0x98165AF37B2153DFULL, 641, 212},
+    {0xE2A0B5DC971F303AULL, 667, 220},
+    {0xA8D9D1535CE3B396ULL, 694, 228},
+    {0xFB9B7CD9A4A7443CULL, 720, 236},
+    {0xBB764C4CA7A44410ULL, 747, 244},
+    {0x8BAB8EEFB6409C1AULL, 774, 252},
+    {0xD01FEF10A657842CULL, 800, 260},
+    {0x9B10A4E5E9913129ULL, 827, 268},
+    {0xE7109BFBA19C0C9DULL, 853, 276},
+    {0xAC2820D9623BF429ULL, 880, 284},
+    {0x80444B5E7AA7CF85ULL, 907, 292},
+    {0xBF21E44003ACDD2DULL, 933, 300},
+    {0x8E679C2F5E44FF8FULL, 960, 308},
+    {0xD433179D9C8CB841ULL, 986, 316},
+    {0x9E19DB92B4E31BA9ULL, 1013, 324},
+};
+
+static QIODiyFp qio_diyfp_mul(QIODiyFp x, QIODiyFp y)
+{
+    uint64_t l, h = qio_mul64(x.f, y.f, &l);
+    h += l >> 63; // 舍入
+    return (QIODiyFp){h, x.e + y.e + 64};
+}
+
+static QIODiyFp qio_diyfp_normalize(QIODiyFp x)
+{
+    int s = __builtin_clzll(x.f);
+    return (QIODiyFp){x.f << s, x.e - s};
+}
+
+/// @brief 在不越过(M-, M+)区间的前提下，把最后一位往w的方向调整
+static void qio_grisu2_round(char *buf, int len, uint64_t dist, uint64_t delta, uint64_t rest, uint64_t tenk)
+{
+    while (rest < dist && delta - rest >= tenk && (rest + tenk < dist || dist - rest > rest + tenk - dist))
     {
-        int p = 0;
-        while (x)
+        --buf[len - 1];
+        rest += tenk;
+    }
+}
+
+/// @brief Grisu2：生成能唯一还原v的最短（绝大多数情况下）十进制数字
+/// @param buf 存放数字，至少17字节
+/// @param k 返回十进制指数，值为buf×10^k
+/// @return 数字个数
+static int qio_grisu2(double v, char *buf, int *k)
+{
+    uint64_t f;
+    int e;
+    qio_decompose(v, &f, &e);
+    uint64_t bits;
+    memcpy(&bits, &v, 8);
+    bool lowerCloser = (bits & ((1ULL << 52) - 1)) == 0 && (bits >> 52) > 1;
+    // v的两个相邻浮点数的中点m-和m+，区间内的任何十进制数都会被读回成v
+    QIODiyFp wp = qio_diyfp_normalize((QIODiyFp){2 * f + 1, e - 1});
+    QIODiyFp wm = lowerCloser ? (QIODiyFp){4 * f - 1, e - 2} : (QIODiyFp){2 * f - 1, e - 1};
+    wm = (QIODiyFp){wm.f << (wm.e - wp.e), wp.e};
+    QIODiyFp w = qio_diyfp_normalize((QIODiyFp){f, e});
+    // 选一个10^-k使乘积的指数落在[-60,-32]内
+    int fe = -60 - wp.e - 1;
+    int kk = (fe * 78913) / (1 << 18) + (fe > 0);
+    int index = (300 + kk + 7) / 8;
+    QIODiyFp c = {cachedpowers[index].f, cachedpowers[index].e};
+    *k = -cachedpowers[index].k;
+    w = qio_diyfp_mul(w, c);
+    wm = qio_diyfp_mul(wm, c);
+    wp = qio_diyfp_mul(wp, c);
+    wm.f += 1;
+    wp.f -= 1;
+    uint64_t delta = wp.f - wm.f, dist = wp.f - w.f;
+    // 整数部分p1（不超过32位）与小数部分p2
+    QIODiyFp one = {1ULL << -wp.e, wp.e};
+    uint32_t p1 = (uint32_t)(wp.f >> -one.e);
+    uint64_t p2 = wp.f & (one.f - 1);
+    int n = qio_digits_u64(p1), len = 0;
+    uint32_t pow10 = (uint32_t)pow10u64[n - 1];
+    while (n > 0)
+    {
+        buf[len++] = (char)('0' + p1 / pow10);
+        p1 %= pow10;
+        --n;
+        uint64_t rest = ((uint64_t)p1 << -one.e) + p2;
+        if (rest <= delta)
         {
-            outputbuf[p++] = x % 10;
-            x /= 10;
+            *k += n;
+            qio_grisu2_round(buf, len, dist, delta, rest, (uint64_t)pow10 << -one.e);
+            return len;
         }
-        for (int i = p - 1; i >= 0; i--)
-            putchar('0' + outputbuf[i]); // 逆序输出
+        pow10 /= 10;
     }
+    int m = 0;
+    for (;;)
+    {
+        p2 *= 10;
+        buf[len++] = (char)('0' + (p2 >> -one.e));
+        p2 &= one.f - 1;
+        ++m;
+        delta *= 10;
+        dist *= 10;
+        if (p2 <= delta)
+            break;
+    }
+    *k -= m;
+    qio_grisu2_round(buf, len, dist, delta, p2, one.f);
+    return len;
 }
 
-/// @brief 输出精度为precision的浮点数(四舍五入)
-/// @param precision 精度
+/// @brief 向流输出能被精确读回的最短浮点表示
+/// @param this 指向目标流的指针
 /// @param x 要输出的浮点数
-/// @note 对-0.0输出-0.000000 如果precision为0，则只输出离x最近的整数
-void QIOPutDouble(int precision, double x)
+/// @note 基于Grisu2：结果总能round-trip，且绝大多数情况下就是最短表示。
+///       小数点位置在(-4, 15]范围内时用普通小数（整数不带小数点），否则用科学计数法如1.5e-07；
+///       inf和nan输出为"inf"、"nan"
+void QIOStreamPutDoubleShortest(QIOStream *this, double x)
 {
-    if (signbit(x)) // from <math.h>, return true if the sign of x is negative（就相当于返回x的符号位）
+    if (signbit(x))
     {
         x = -x;
-        putchar('-');
+        qio_putc(this, '-');
     }
-    if (precision)
+    if (isnan(x))
     {
-        // 整数部分
-        double intpart;
-        x = modf(x, &intpart); // from <math.h>
-        unsigned_output((int)intpart);
-        // 小数部分
-        putchar('.');
-        for (int i = 1; i < precision && x < dten[i]; ++i)
-            putchar('0'); // 输出小数点后有多少0
-        int ten = 1;
-        while (precision--)
-            ten *= 10;
-        unsigned_output((int)round(x * ten));
+        qio_puts(this, "nan");
+        return;
+    }
+    if (isinf(x))
+    {
+        qio_puts(this, "inf");
+        return;
+    }
+    if (x == 0)
+    {
+        qio_putc(this, '0');
+        return;
+    }
+    char buf[32];
+    int k, len = qio_grisu2(x, buf, &k);
+    int point = len + k; // 小数点在第point位数字之后
+    char *p = qio_reserve(this, 32);
+    if (k >= 0 && point <= 15)
+    {
+        memcpy(p, buf, len);
+        memset(p + len, '0', k);
+        p += point;
+    }
+    else if (point > 0 && point <= 15)
+    {
+        memcpy(p, buf, point);
+        p[point] = '.';
+        memcpy(p + point + 1, buf + point, len - point);
+        p += len + 1;
+    }
+    else if (point > -4 && point <= 0)
+    {
+        memcpy(p, "0.000", 2 - point);
+        memcpy(p + 2 - point, buf, len);
+        p += 2 - point + len;
     }
     else
-        unsigned_output((int)round(x));
+    {
+        *p++ = buf[0];
+        if (len > 1)
+        {
+            *p++ = '.';
+            memcpy(p, buf + 1, len - 1);
+            p += len - 1;
+        }
+        int ex = point - 1;
+        *p++ = 'e';
+        *p++ = ex < 0 ? '-' : '+';
+        if (ex < 0)
+            ex = -ex;
+        p = qio_format_digits(p, ex, ex < 100 ? 2 : 3);
+    }
+    this->out.cur = p;
+}
+
+/// @brief 创建一个QuickIO流
+/// @param this 指向要创建的流结构体的指针
+/// @param infd 输入的文件描述符，为-1表示不用于输入；是普通文件时直接mmap
+/// @param outfd 输出的文件描述符，为-1表示不用于输出
+/// @note 每个流独占自己的缓冲区，不同线程各用各的流时不需要任何同步；同一个流不能被多个线程同时使用。
+///       流不负责关闭infd和outfd
+/// @return 缓冲区分配成功返回true，否则返回false
+bool QIOStreamCreate(QIOStream *this, int infd, int outfd)
+{
+    memset(this, 0, sizeof(*this));
+    this->in.size = this->out.size = QIO_DEFAULT_BUFFER_SIZE;
+    this->in.fd = infd;
+    this->out.fd = outfd;
+    if (!qio_input_init(this))
+        return false;
+    if (outfd >= 0 && !qio_output_init(this))
+    {
+        QIOStreamDelete(this);
+        return false;
+    }
+    return true;
+}
+
+/// @brief 删除QuickIO流：刷新输出，解除映射并释放缓冲区
+/// @param this 指向要删除的流结构体的指针
+void QIOStreamDelete(QIOStream *this)
+{
+    QIOStreamFlush(this);
+    qio_close_input(this);
+    free(this->in.buf);
+    if (this->out.buf != outputfallback)
+        free(this->out.buf);
+    memset(this, 0, sizeof(*this));
+    this->in.fd = this->out.fd = -1;
+}
+
+// 以下是默认stdio流上的包装
+
+bool QIOSetBufferSize(size_t size)
+{
+    return QIOStreamSetBufferSize(&qio_stdio, size);
+}
+
+bool QIOOpenMapped(const char *path)
+{
+    return QIOStreamOpenMapped(&qio_stdio, path);
+}
+
+bool QIOEnableReadAhead(size_t ringSize)
+{
+    return QIOStreamEnableReadAhead(&qio_stdio, ringSize);
+}
+
+bool QIOGetInt(int *x)
+{
+    return QIOStreamGetInt(&qio_stdio, x);
+}
+
+bool QIOGetI64(int64_t *x)
+{
+    return QIOStreamGetI64(&qio_stdio, x);
+}
+
+bool QIOGetU64(uint64_t *x)
+{
+    return QIOStreamGetU64(&qio_stdio, x);
+}
+
+#ifdef __SIZEOF_INT128__
+bool QIOGetI128(QIOInt128 *x)
+{
+    return QIOStreamGetI128(&qio_stdio, x);
+}
+
+bool QIOGetU128(QIOUInt128 *x)
+{
+    return QIOStreamGetU128(&qio_stdio, x);
+}
+#endif
+
+bool QIOGetDouble(double *x)
+{
+    return QIOStreamGetDouble(&qio_stdio, x);
+}
+
+size_t QIOGetIntArray(int *out, size_t n)
+{
+    return QIOStreamGetIntArray(&qio_stdio, out, n);
+}
+
+size_t QIOGetI64Array(int64_t *out, size_t n)
+{
+    return QIOStreamGetI64Array(&qio_stdio, out, n);
+}
+
+bool QIOSetOutputBufferSize(size_t size)
+{
+    return QIOStreamSetOutputBufferSize(&qio_stdio, size);
+}
+
+bool QIOFlush(void)
+{
+    return QIOStreamFlush(&qio_stdio);
+}
+
+void QIOPutSpan(const void *data, size_t len)
+{
+    QIOStreamPutSpan(&qio_stdio, data, len);
+}
+
+void QIOPutInt(int x)
+{
+    QIOStreamPutInt(&qio_stdio, x);
+}
+
+void QIOPutI64(int64_t x)
+{
+    QIOStreamPutI64(&qio_stdio, x);
+}
+
+void QIOPutU64(uint64_t x)
+{
+    QIOStreamPutU64(&qio_stdio, x);
+}
+
+#ifdef __SIZEOF_INT128__
+void QIOPutI128(QIOInt128 x)
+{
+    QIOStreamPutI128(&qio_stdio, x);
+}
+
+void QIOPutU128(QIOUInt128 x)
+{
+    QIOStreamPutU128(&qio_stdio, x);
+}
+#endif
+
+void QIOPutDouble(int precision, double x)
+{
+    QIOStreamPutDouble(&qio_stdio, precision, x);
+}
+
+void QIOPutDoubleShortest(double x)
+{
+    QIOStreamPutDoubleShortest(&qio_stdio, x);
 }
\ No newline at end of file
@@ -3,15 +3,161 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include <sys/uio.h>
+
+#define QIO_DEFAULT_BUFFER_SIZE (1 << 16)    // 输入/输出缓冲区默认大小
+#define QIO_MIN_OUTPUT_BUFFER_SIZE 4096      // 输出缓冲区最小大小，保证单个数值总能一次写入
+#define QIO_MAX_SPANS 16                     // 两次刷新之间最多登记的外部数据段数
+#define QIO_SPAN_COPY_THRESHOLD 512          // 短于此长度的外部数据直接复制进缓冲区
+#define QIO_DEFAULT_READAHEAD_SIZE (1 << 22) // 预读环形缓冲区默认大小
+
+#ifdef __SIZEOF_INT128__ // 128位整数的接口只在编译器支持__int128的目标（64位平台）上提供
+__extension__ typedef __int128 QIOInt128;
+__extension__ typedef unsigned __int128 QIOUInt128;
+#endif
+
+/// 输入缓冲区：流的所有读函数共享，用大块read()填充，逐字节的getchar()只作为默认stdio流缓冲区不可用时的后备路径。
+/// 输入是普通文件时直接mmap整个文件，cur/end指向映射区，不再经过缓冲区复制。
+typedef struct QIOInput
+{
+    char *buf;                  ///< 缓冲区起始地址
+    char *cur;                  ///< 读游标
+    char *end;                  ///< 有效数据末尾
+    size_t size;                ///< 缓冲区容量（字节）
+    char *map;                  ///< 映射区起始地址，未映射时为NULL
+    size_t mapLen;              ///< 映射区长度
+    int fd;                     ///< 数据来源的文件描述符
+    bool ownfd;                 ///< fd是否由QuickIO打开（需要负责关闭）
+    bool inited;                ///< 是否已经初始化
+    bool eof;                   ///< 是否已经读到文件末尾
+    bool fallback;              ///< 缓冲区分配失败时退化为getchar()（仅默认stdio流）
+    bool borrowed;              ///< cur/end指向调用者提供的内存（QIOStreamOpenMemory），不归流所有
+    struct QIOReadAhead *ahead; ///< 预读线程及其环形缓冲区，未开启预读时为NULL
+} QIOInput;
+
+/// 输出缓冲区：格式化结果直接写入其中，满了或刷新时用一次write()/writev()写出
+typedef struct QIOOutput
+{
+    char *buf;                               ///< 缓冲区起始地址
+    char *cur;                               ///< 写游标
+    char *end;                               ///< 缓冲区末尾
+    char *mark;                              ///< 尚未登记到iov中的缓冲数据的起点
+    size_t size;                             ///< 缓冲区容量（字节）
+    int fd;                                  ///< 输出目标的文件描述符
+    int iovcnt;                              ///< 已登记的iov段数
+    struct iovec iov[QIO_MAX_SPANS * 2 + 1]; ///< 缓冲数据与外部数据段交替排列
+} QIOOutput;
+
+/// QuickIO流：独占一个输入文件描述符和一个输出文件描述符以及各自的缓冲区，流之间没有共享状态
+typedef struct QIOStream
+{
+    QIOInput in;
+    QIOOutput out;
+} QIOStream;
+
+bool QIOStreamCreate(QIOStream *this, int infd, int outfd);
+
+void QIOStreamDelete(QIOStream *this);
+
+bool QIOStreamSetBufferSize(QIOStream *this, size_t size);
+
+bool QIOStreamOpenMapped(QIOStream *this, const char *path);
+
+void QIOStreamOpenMemory(QIOStream *this, const char *data, size_t len);
+
+bool QIOStreamEnableReadAhead(QIOStream *this, size_t ringSize);
+
+bool QIOStreamGetInt(QIOStream *this, int *x);
+
+bool QIOStreamGetI64(QIOStream *this, int64_t *x);
+
+bool QIOStreamGetU64(QIOStream *this, uint64_t *x);
+
+#ifdef __SIZEOF_INT128__
+bool QIOStreamGetI128(QIOStream *this, QIOInt128 *x);
+
+bool QIOStreamGetU128(QIOStream *this, QIOUInt128 *x);
+#endif
+
+bool QIOStreamGetDouble(QIOStream *this, double *x);
+
+size_t QIOStreamGetIntArray(QIOStream *this, int *out, size_t n);
+
+size_t QIOStreamGetI64Array(QIOStream *this, int64_t *out, size_t n);
+
+bool QIOStreamSetOutputBufferSize(QIOStream *this, size_t size);
+
+bool QIOStreamFlush(QIOStream *this);
+
+void QIOStreamPutSpan(QIOStream *this, const void *data, size_t len);
+
+void QIOStreamPutInt(QIOStream *this, int x);
+
+void QIOStreamPutI64(QIOStream *this, int64_t x);
+
+void QIOStreamPutU64(QIOStream *this, uint64_t x);
+
+#ifdef __SIZEOF_INT128__
+void QIOStreamPutI128(QIOStream *this, QIOInt128 x);
+
+void QIOStreamPutU128(QIOStream *this, QIOUInt128 x);
+#endif
+
+void QIOStreamPutDouble(QIOStream *this, int precision, double x);
+
+void QIOStreamPutDoubleShortest(QIOStream *this, double x);
+
+// 以下接口作用于默认的stdio流（stdin/stdout）
+
+bool QIOInit(void);
+
+bool QIOSetBufferSize(size_t size);
+
+bool QIOOpenMapped(const char *path);
+
+bool QIOEnableReadAhead(size_t ringSize);
 
 bool QIOGetInt(int *x);
 
-void QIOGetDouble(double *x);
+bool QIOGetI64(int64_t *x);
+
+bool QIOGetU64(uint64_t *x);
+
+#ifdef __SIZEOF_INT128__
+bool QIOGetI128(QIOInt128 *x);
+
+bool QIOGetU128(QIOUInt128 *x);
+#endif
+
+bool QIOGetDouble(double *x);
+
+size_t QIOGetIntArray(int *out, size_t n);
+
+size_t QIOGetI64Array(int64_t *out, size_t n);
+
+bool QIOSetOutputBufferSize(size_t size);
+
+bool QIOFlush(void);
+
+void QIOPutSpan(const void *data, size_t len);
 
 void QIOPutInt(int x);
 
+void QIOPutI64(int64_t x);
+
+void QIOPutU64(uint64_t x);
+
+#ifdef __SIZEOF_INT128__
+void QIOPutI128(QIOInt128 x);
+
+void QIOPutU128(QIOUInt128 x);
+#endif
+
 void QIOPutDouble(int precision, double x);
 
+void QIOPutDoubleShortest(double x);
+
 #endif
 
 
@@ -0,0 +1,261 @@
+#include "quick_io_parallel.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <ctype.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <pthread.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/// 并行读取的元素类型
+typedef enum QIOParallelType
+{
+    QIO_PARALLEL_INT,
+    QIO_PARALLEL_I64,
+    QIO_PARALLEL_DOUBLE
+} QIOParallelType;
+
+/// 一个线程负责的数据块
+typedef struct QIOParallelJob
+{
+    const char *begin;    ///< 数据块起始地址
+    const char *end;      ///< 数据块末尾
+    QIOParallelType type; ///< 元素类型
+    Vector local;         ///< 本块解析出的结果
+    bool ok;              ///< 本块是否解析成功
+    Vector *out;          ///< 最终结果
+    size_t offset;        ///< 本块结果在out中的起始下标（前缀和）
+} QIOParallelJob;
+
+static const size_t qio_parallel_value_size[] = {sizeof(int), sizeof(int64_t), sizeof(double)};
+
+/// @brief 把[begin, end)按空白字符切成count块，每块的边界都落在空白字符上，因此数字不会被切断
+static void qio_parallel_split(const char *data, size_t len, QIOParallelJob *jobs, size_t count)
+{
+    const char *p = data, *end = data + len;
+    for (size_t i = 0; i < count; ++i)
+    {
+        const char *stop = i + 1 == count ? end : data + len / count * (i + 1);
+        if (stop < p)
+            stop = p;
+        while (stop < end && !isspace((unsigned char)*stop))
+            ++stop;
+        jobs[i].begin = p;
+        jobs[i].end = stop;
+        p = stop;
+    }
+}
+
+/// @brief 第一阶段：用一个内存输入的QIOStream解析本块，结果放进本块自己的Vector
+static void *qio_parallel_parse(void *arg)
+{
+    QIOParallelJob *job = (QIOParallelJob *)arg;
+    size_t valueSize = qio_parallel_value_size[job->type];
+    // 与out一样先建空的Vector再预留，VectorCreate会把预估的整块内存清零，而这些页应当在写入结果时才第一次被访问
+    job->ok = VectorCreate(&job->local, 0, valueSize);
+    if (!job->ok)
+        return NULL;
+    if (!VectorReserve(&job->local, (job->end - job->begin) / 8 + 16))
+    {
+        VectorDelete(&job->local);
+        job->ok = false;
+        return NULL;
+    }
+    QIOStream stream;
+    QIOStreamCreate(&stream, -1, -1);
+    QIOStreamOpenMemory(&stream, job->begin, job->end - job->begin);
+    for (;;)
+    {
+        if (VectorIsFull(&job->local) && !VectorResize(&job->local, job->local.size * 2))
+        {
+            job->ok = false;
+            break;
+        }
+        size_t room = job->local.size - job->local.len;
+        char *dst = (char *)job->local.data + job->local.len * valueSize;
+        size_t got = 0;
+        switch (job->type)
+        {
+        case QIO_PARALLEL_INT:
+            got = QIOStreamGetIntArray(&stream, (int *)dst, room);
+            break;
+        case QIO_PARALLEL_I64:
+            got = QIOStreamGetI64Array(&stream, (int64_t *)dst, room);
+            break;
+        case QIO_PARALLEL_DOUBLE:
+            while (got < room && QIOStreamGetDouble(&stream, (double *)dst + got))
+                ++got;
+            break;
+        }
+        job->local.len += got;
+        if (got < room) // 本块已经读完
+            break;
+    }
+    QIOStreamDelete(&stream);
+    return NULL;
+}
+
+/// @brief 第二阶段：把本块的结果复制到out中前缀和给出的位置，然后释放本块的Vector
+static void *qio_parallel_gather(void *arg)
+{
+    QIOParallelJob *job = (QIOParallelJob *)arg;
+    size_t valueSize = job->local.valueSize;
+    if (job->local.len > 0)
+        memcpy((char *)job->out->data + job->offset * valueSize, job->local.data, job->local.len * valueSize);
+    VectorDelete(&job->local);
+    return NULL;
+}
+
+/// @brief 对每个数据块各用一个线程执行fn；第0块在调用线程上执行，线程创建失败的块也退回调用线程执行
+static void qio_parallel_run(QIOParallelJob *jobs, size_t count, void *(*fn)(void *))
+{
+    pthread_t *threads = (pthread_t *)malloc(count * sizeof(pthread_t));
+    bool *started = (bool *)calloc(count, sizeof(bool));
+    if (threads == NULL || started == NULL)
+    {
+        for (size_t i = 0; i < count; ++i)
+            fn(&jobs[i]);
+        free(threads);
+        free(started);
+        return;
+    }
+    for (size_t i = 1; i < count; ++i)
+        started[i] = pthread_create(&threads[i], NULL, fn, &jobs[i]) == 0;
+    fn(&jobs[0]);
+    for (size_t i = 1; i < count; ++i)
+    {
+        if (started[i])
+            pthread_join(threads[i], NULL);
+        else
+            fn(&jobs[i]);
+    }
+    free(threads);
+    free(started);
+}
+
+/// @brief 并行读取的公共实现：映射文件，切块并行解析，按块的前缀和把结果按文件顺序拼接进out
+static bool qio_parallel_read(const char *path, Vector *out, size_t threads, QIOParallelType type)
+{
+    size_t valueSize = qio_parallel_value_size[type];
+    int fd = open(path, O_RDONLY);
+    if (fd < 0)
+    {
+        fprintf(stderr, "QuickIO failed to open %s.\n", path);
+        return false;
+    }
+    struct stat st;
+    if (fstat(fd, &st) != 0 || !S_ISREG(st.st_mode))
+    {
+        fprintf(stderr, "QuickIO parallel read needs a regular file: %s.\n", path);
+        close(fd);
+        return false;
+    }
+    size_t len = st.st_size;
+    if (len == 0)
+    {
+        close(fd);
+        return VectorCreate(out, 0, valueSize);
+    }
+    void *map = mmap(NULL, len, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+    if (map == MAP_FAILED)
+    {
+        fprintf(stderr, "QuickIO failed to map %s.\n", path);
+        return false;
+    }
+    madvise(map, len, MADV_SEQUENTIAL);
+
+    size_t count = threads;
+    if (count == 0)
+    {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        count = online > 0 ? (size_t)online : 1;
+    }
+    if (count > len / QIO_PARALLEL_MIN_CHUNK)
+        count = len / QIO_PARALLEL_MIN_CHUNK > 0 ? len / QIO_PARALLEL_MIN_CHUNK : 1;
+    QIOParallelJob *jobs = (QIOParallelJob *)calloc(count, sizeof(QIOParallelJob));
+    if (jobs == NULL)
+    {
+        fprintf(stderr, "Memory allocation failed for QuickIO parallel jobs.\n");
+        munmap(map, len);
+        return false;
+    }
+    qio_parallel_split((const char *)map, len, jobs, count);
+    for (size_t i = 0; i < count; ++i)
+        jobs[i].type = type;
+
+    qio_parallel_run(jobs, count, qio_parallel_parse);
+    munmap(map, len);
+
+    // 前缀和：每块结果在out中的起始下标
+    bool ok = true;
+    size_t total = 0;
+    for (size_t i = 0; i < count; ++i)
+    {
+        ok = ok && jobs[i].ok;
+        jobs[i].offset = total;
+        jobs[i].out = out;
+        total += jobs[i].local.len;
+    }
+    // 建一个空的Vector再一次预留total个元素，避免VectorCreate把整块结果内存清零
+    if (ok && VectorCreate(out, 0, valueSize))
+    {
+        if (!VectorReserve(out, total))
+        {
+            VectorDelete(out);
+            ok = false;
+        }
+    }
+    else
+    {
+        ok = false;
+    }
+    if (ok)
+    {
+        qio_parallel_run(jobs, count, qio_parallel_gather);
+        out->len = total;
+    }
+    else
+    {
+        for (size_t i = 0; i < count; ++i)
+            VectorDelete(&jobs[i].local);
+    }
+    free(jobs);
+    return ok;
+}
+
+/// @brief 用多个线程并行读取文件中的全部int，按文件中的顺序存入out
+/// @param path 文件路径，必须是可以mmap的普通文件
+/// @param out 存放结果的向量，由本函数创建（元素大小为sizeof(int)），使用完后需要调用VectorDelete
+/// @param threads 线程数，为0时使用在线的CPU核数；文件较小时每个线程至少分到QIO_PARALLEL_MIN_CHUNK字节
+/// @note 文件被映射后在空白字符处切成若干块，每块用一个内存输入的QIOStream解析（分隔符规则与QIOGetIntArray相同），
+///       各块的结果按前缀和给出的位置并行复制进out
+/// @return 成功返回true；文件打不开、不是普通文件或内存分配失败时返回false，此时out未被创建
+bool QIOParallelReadInt(const char *path, Vector *out, size_t threads)
+{
+    return qio_parallel_read(path, out, threads, QIO_PARALLEL_INT);
+}
+
+/// @brief 用多个线程并行读取文件中的全部int64_t，按文件中的顺序存入out
+/// @param path 文件路径，必须是可以mmap的普通文件
+/// @param out 存放结果的向量，由本函数创建（元素大小为sizeof(int64_t)），使用完后需要调用VectorDelete
+/// @param threads 线程数，为0时使用在线的CPU核数
+/// @return 成功返回true；文件打不开、不是普通文件或内存分配失败时返回false，此时out未被创建
+bool QIOParallelReadI64(const char *path, Vector *out, size_t threads)
+{
+    return qio_parallel_read(path, out, threads, QIO_PARALLEL_I64);
+}
+
+/// @brief 用多个线程并行读取文件中的全部浮点数，按文件中的顺序存入out
+/// @param path 文件路径，必须是可以mmap的普通文件
+/// @param out 存放结果的向量，由本函数创建（元素大小为sizeof(double)），使用完后需要调用VectorDelete
+/// @param threads 线程数，为0时使用在线的CPU核数
+/// @note 数字之间必须用空白字符分隔，解析规则与QIOGetDouble相同
+/// @return 成功返回true；文件打不开、不是普通文件或内存分配失败时返回false，此时out未被创建
+bool QIOParallelReadDouble(const char *path, Vector *out, size_t threads)
+{
+    return qio_parallel_read(path, out, threads, QIO_PARALLEL_DOUBLE);
+}
\ No newline at end of file
@@ -0,0 +1,18 @@
+#ifndef __QUICK_IO_PARALLEL_H__
+#define __QUICK_IO_PARALLEL_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "quick_io.h"
+#include "../vector/vector.h"
+
+#define QIO_PARALLEL_MIN_CHUNK (1 << 20) // 每个线程至少分到的字节数，文件较小时减少线程数
+
+bool QIOParallelReadInt(const char *path, Vector *out, size_t threads);
+
+bool QIOParallelReadI64(const char *path, Vector *out, size_t threads);
+
+bool QIOParallelReadDouble(const char *path, Vector *out, size_t threads);
+
+#endif
@@ -2,11 +2,24 @@
  * @file RingBuffer相关操作函数的实现
  * @brief 这个文件包含了用于操作RingBuffer（环形缓冲区）的一系列函数，涵盖创建、判断状态、读写数据以及清除等功能。
  */
+#define _GNU_SOURCE // memfd_create
 #include "ringbuffer.h"
 
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <errno.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/uio.h>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define RINGBUFFER_USE_IO_URING // RingBufferDrainBatch直接通过io_uring系统调用成批写出，不依赖liburing
+#include <linux/io_uring.h>
+#include <sys/syscall.h>
+#endif
+#endif
 
 // 假设这里有MIN宏定义用于取最小值，若实际不存在需补充合适的实现
 #define MIN(a, b) ((a) < (b) ? (a) : (b))
@@ -15,7 +28,7 @@
  * @brief 创建一个RingBuffer（环形缓冲区）实例。
  *
  * @param capacity 环形缓冲区的容量大小，以字节为单位。
- * @return RingBuffer 返回创建好的RingBuffer结构体实例，如果内存分配失败则返回的结构体中相关成员可能处于未初始化的无效状态（需根据实际使用情况处理错误）。
+ * @return RingBuffer 返回创建好的RingBuffer结构体实例，如果内存分配失败则返回的结构体中buffer为NULL、capacity为0（调用者需检查buffer）。
  */
 RingBuffer RingBufferCreate(size_t capacity)
 {
@@ -24,13 +37,102 @@ RingBuffer RingBufferCreate(size_t capacity)
     if (!rbuf.buffer)
     {
         fprintf(stderr, "Memory allocation failed for RingBuffer.\n");
-        return;
+        rbuf.capacity = 0;
+        rbuf.head = 0;
+        rbuf.tail = 0;
+        rbuf.count = 0;
+        rbuf.mask = 0;
+        rbuf.mirrored = false;
+        return rbuf;
     }
     rbuf.capacity = capacity;
     rbuf.head = 0;
     rbuf.tail = 0;
     rbuf.count = 0;
+    rbuf.mask = 0;
+    rbuf.mirrored = false;
+
+    return rbuf;
+}
 
+/**
+ * @brief 创建一个容量为2的幂的RingBuffer（环形缓冲区）实例。
+ *
+ * 这种模式下head和tail是单调递增的字节计数，访问缓冲区时用mask取低位代替取模，已存储的字节数由head - tail得到，
+ * 读写时不需要整数除法，绕回的处理也只是把一次复制拆成两段。其余接口的用法与普通模式完全相同。
+ *
+ * @param capacity 期望的容量大小（字节），会向上取整为2的幂，至少为2。
+ * @return RingBuffer 返回创建好的RingBuffer结构体实例，如果内存分配失败则返回的结构体中buffer为NULL、capacity为0（调用者需检查buffer）。
+ */
+RingBuffer RingBufferCreatePow2(size_t capacity)
+{
+    size_t size = 2; // 容量为1时mask为0，无法与普通模式区分
+    while (size < capacity)
+    {
+        size <<= 1;
+    }
+    RingBuffer rbuf = RingBufferCreate(size);
+    if (rbuf.buffer)
+    {
+        rbuf.mask = size - 1;
+    }
+    return rbuf;
+}
+
+/**
+ * @brief 创建一个镜像模式的RingBuffer（环形缓冲区）实例。
+ *
+ * 用memfd创建一段共享内存，再把它在地址空间里连续映射两次：buffer[i]与buffer[i + capacity]是同一个字节。
+ * 因此从任意位置开始的、长度不超过capacity的区域都是连续的，配合RingBufferWriteReserve/RingBufferWriteCommit和
+ * RingBufferPeek/RingBufferConsume，生产者可以直接在缓冲区里写数据，消费者可以直接在缓冲区里解析，不需要额外复制。
+ * 镜像模式同时也是2的幂模式，其余接口的用法与普通模式完全相同。
+ *
+ * @param capacity 期望的容量大小（字节），会向上取整为2的幂且不小于页大小。
+ * @return RingBuffer 返回创建好的RingBuffer结构体实例，如果memfd或映射失败则返回的结构体中buffer为NULL、capacity为0（调用者需检查buffer）。
+ */
+RingBuffer RingBufferCreateMirrored(size_t capacity)
+{
+    RingBuffer rbuf = {NULL, 0, 0, 0, 0, 0, false};
+    size_t size = (size_t)sysconf(_SC_PAGESIZE);
+    while (size < capacity)
+    {
+        size <<= 1;
+    }
+
+    int fd = memfd_create("ringbuffer", MFD_CLOEXEC);
+    if (fd < 0)
+    {
+        fprintf(stderr, "memfd_create failed for mirrored RingBuffer.\n");
+        return rbuf;
+    }
+    if (ftruncate(fd, size) != 0)
+    {
+        fprintf(stderr, "ftruncate failed for mirrored RingBuffer.\n");
+        close(fd);
+        return rbuf;
+    }
+    // 先占住两倍大小的地址空间，再把同一段memfd固定映射到前后两半
+    uint8_t *base = (uint8_t *)mmap(NULL, size * 2, PROT_NONE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED)
+    {
+        fprintf(stderr, "Address space reservation failed for mirrored RingBuffer.\n");
+        close(fd);
+        return rbuf;
+    }
+    if (mmap(base, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED ||
+        mmap(base + size, size, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_FIXED, fd, 0) == MAP_FAILED)
+    {
+        fprintf(stderr, "Mapping failed for mirrored RingBuffer.\n");
+        munmap(base, size * 2);
+        close(fd);
+        return rbuf;
+    }
+    close(fd); // 映射会保持memfd的内存，不再需要文件描述符
+
+    rbuf.buffer = base;
+    rbuf.capacity = size;
+    rbuf.mask = size - 1;
+    rbuf.mirrored = true;
     return rbuf;
 }
 
@@ -42,7 +144,7 @@ RingBuffer RingBufferCreate(size_t capacity)
  */
 bool RingBufferIsFull(const RingBuffer *rbuf)
 {
-    return rbuf->count == rbuf->capacity;
+    return RingBufferSize(rbuf) == rbuf->capacity;
 }
 
 /**
@@ -53,7 +155,7 @@ bool RingBufferIsFull(const RingBuffer *rbuf)
  */
 bool RingBufferIsEmpty(const RingBuffer *rbuf)
 {
-    return rbuf->count == 0;
+    return RingBufferSize(rbuf) == 0;
 }
 
 /**
@@ -64,7 +166,35 @@ bool RingBufferIsEmpty(const RingBuffer *rbuf)
  */
 size_t RingBufferSize(const RingBuffer *rbuf)
 {
-    return rbuf->count;
+    return rbuf->mask ? rbuf->head - rbuf->tail : rbuf->count;
+}
+
+/**
+ * @brief 2的幂模式下的写入：head取低位得到写位置，最多分两段复制，不需要取模和绕回判断。
+ */
+static size_t ringbuffer_write_pow2(RingBuffer *rbuf, const uint8_t *data, size_t len)
+{
+    size_t bytes_to_write = MIN(len, rbuf->capacity - (rbuf->head - rbuf->tail));
+    size_t pos = rbuf->head & rbuf->mask;
+    size_t first = MIN(bytes_to_write, rbuf->capacity - pos);
+    memcpy(&rbuf->buffer[pos], data, first);
+    memcpy(rbuf->buffer, data + first, bytes_to_write - first);
+    rbuf->head += bytes_to_write;
+    return bytes_to_write;
+}
+
+/**
+ * @brief 2的幂模式下的读取：tail取低位得到读位置，最多分两段复制，不需要取模和绕回判断。
+ */
+static size_t ringbuffer_read_pow2(RingBuffer *rbuf, uint8_t *data, size_t len)
+{
+    size_t bytes_to_read = MIN(len, rbuf->head - rbuf->tail);
+    size_t pos = rbuf->tail & rbuf->mask;
+    size_t first = MIN(bytes_to_read, rbuf->capacity - pos);
+    memcpy(data, &rbuf->buffer[pos], first);
+    memcpy(data + first, rbuf->buffer, bytes_to_read - first);
+    rbuf->tail += bytes_to_read;
+    return bytes_to_read;
 }
 
 /**
@@ -73,15 +203,15 @@ size_t RingBufferSize(const RingBuffer *rbuf)
  * @param rbuf 指向要写入数据的RingBuffer结构体的指针。
  * @param data 指向要写入的数据缓冲区的指针，数据从此处获取。
  * @param len 要写入的数据长度（字节数）。
- * @return size_t 实际成功写入到RingBuffer中的字节数，如果缓冲区已满或者要写入的长度超过容量等情况导致无法写入，则返回0。
+ * @return size_t 实际成功写入到RingBuffer中的字节数，剩余空间不足时只写入能放下的部分，缓冲区已满时返回0。
  */
 size_t RingBufferWriteData(RingBuffer *rbuf, uint8_t *data, size_t len)
 {
-    if (len >= rbuf->capacity)
+    if (rbuf->mask)
     {
-        return 0;
+        return ringbuffer_write_pow2(rbuf, data, len);
     }
-    if (is_rbuf_full(rbuf))
+    if (RingBufferIsFull(rbuf))
     {
         return 0; // 缓冲区已满，未写入字节.
     }
@@ -115,17 +245,17 @@ size_t RingBufferWriteData(RingBuffer *rbuf, uint8_t *data, size_t len)
  * @param rbuf 指向要读取数据的RingBuffer结构体的指针。
  * @param data 指向用于存放读取出来的数据的缓冲区的指针，数据将被复制到此缓冲区。
  * @param len 期望读取的数据长度（字节数）。
- * @return size_t 实际成功从RingBuffer中读取出来的字节数，如果缓冲区为空或者期望读取长度超过容量等情况导致无法读取，则返回0。
+ * @return size_t 实际成功从RingBuffer中读取出来的字节数，已存储的数据不足len时只读取现有的部分，缓冲区为空时返回0。
  */
 size_t RingBufferReadData(RingBuffer *rbuf, uint8_t *data, size_t len)
 {
-    if (rbuf->count == 0)
+    if (rbuf->mask)
     {
-        return 0; // 缓冲区为空，没有读取到字节
+        return ringbuffer_read_pow2(rbuf, data, len);
     }
-    if (len >= rbuf->capacity)
+    if (rbuf->count == 0)
     {
-        return 0;
+        return 0; // 缓冲区为空，没有读取到字节
     }
     size_t bytes_to_read = MIN(len, rbuf->count);
 
@@ -149,6 +279,447 @@ size_t RingBufferReadData(RingBuffer *rbuf, uint8_t *data, size_t len)
     return bytes_to_read;
 }
 
+/**
+ * @brief 写位置的下标
+ */
+static size_t ringbuffer_head_index(const RingBuffer *rbuf)
+{
+    return rbuf->mask ? rbuf->head & rbuf->mask : rbuf->head;
+}
+
+/**
+ * @brief 读位置的下标
+ */
+static size_t ringbuffer_tail_index(const RingBuffer *rbuf)
+{
+    return rbuf->mask ? rbuf->tail & rbuf->mask : rbuf->tail;
+}
+
+/**
+ * @brief 预留一段连续的可写区域，调用者直接在返回的地址上写数据，写完后用RingBufferWriteCommit提交。
+ *
+ * @param rbuf 指向要写入数据的RingBuffer结构体的指针。
+ * @param len 需要的字节数。
+ * @return uint8_t* 可写区域的起始地址；剩余空间中连续的部分不足len时返回NULL。
+ *         镜像模式下全部剩余空间都是连续的，其他模式下连续的部分只到缓冲区末尾为止。
+ */
+uint8_t *RingBufferWriteReserve(RingBuffer *rbuf, size_t len)
+{
+    size_t space_left = rbuf->capacity - RingBufferSize(rbuf);
+    size_t pos = ringbuffer_head_index(rbuf);
+    size_t contiguous = rbuf->mirrored ? space_left : MIN(space_left, rbuf->capacity - pos);
+    if (contiguous < len || rbuf->buffer == NULL)
+    {
+        return NULL;
+    }
+    return &rbuf->buffer[pos];
+}
+
+/**
+ * @brief 提交之前用RingBufferWriteReserve预留并已写好的数据。
+ *
+ * @param rbuf 指向RingBuffer结构体的指针。
+ * @param len 实际写入的字节数，不能超过预留时的长度。
+ */
+void RingBufferWriteCommit(RingBuffer *rbuf, size_t len)
+{
+    if (rbuf->mask)
+    {
+        rbuf->head += len;
+    }
+    else
+    {
+        rbuf->head = (rbuf->head + len) % rbuf->capacity;
+        rbuf->count += len;
+    }
+}
+
+/**
+ * @brief 查看当前可读的连续数据而不取出，调用者直接在返回的地址上解析，用完后用RingBufferConsume释放。
+ *
+ * @param rbuf 指向RingBuffer结构体的指针。
+ * @param len 输出参数，返回可读的连续字节数。镜像模式下就是全部已存储的数据，其他模式下只到缓冲区末尾为止。
+ * @return uint8_t* 可读数据的起始地址；缓冲区为空时返回NULL且*len为0。
+ */
+uint8_t *RingBufferPeek(RingBuffer *rbuf, size_t *len)
+{
+    size_t size = RingBufferSize(rbuf);
+    size_t pos = ringbuffer_tail_index(rbuf);
+    *len = rbuf->mirrored ? size : MIN(size, rbuf->capacity - pos);
+    if (*len == 0)
+    {
+        return NULL;
+    }
+    return &rbuf->buffer[pos];
+}
+
+/**
+ * @brief 释放之前用RingBufferPeek查看过的数据的前len个字节。
+ *
+ * @param rbuf 指向RingBuffer结构体的指针。
+ * @param len 要释放的字节数，不能超过RingBufferPeek返回的长度。
+ */
+void RingBufferConsume(RingBuffer *rbuf, size_t len)
+{
+    if (rbuf->mask)
+    {
+        rbuf->tail += len;
+    }
+    else
+    {
+        rbuf->tail = (rbuf->tail + len) % rbuf->capacity;
+        rbuf->count -= len;
+    }
+}
+
+/**
+ * @brief 用至多两段iovec描述空闲区域：从写位置到缓冲区末尾，再从缓冲区开头到读位置。镜像模式下只需要一段。
+ *
+ * @return int iovec的段数，缓冲区已满时为0。
+ */
+static int ringbuffer_free_iov(const RingBuffer *rbuf, struct iovec iov[2])
+{
+    size_t space_left = rbuf->capacity - RingBufferSize(rbuf);
+    if (space_left == 0)
+    {
+        return 0;
+    }
+    size_t pos = ringbuffer_head_index(rbuf);
+    size_t first = rbuf->mirrored ? space_left : MIN(space_left, rbuf->capacity - pos);
+    iov[0].iov_base = &rbuf->buffer[pos];
+    iov[0].iov_len = first;
+    iov[1].iov_base = rbuf->buffer;
+    iov[1].iov_len = space_left - first;
+    return iov[1].iov_len > 0 ? 2 : 1;
+}
+
+/**
+ * @brief 用至多两段iovec描述已存储的数据：从读位置到缓冲区末尾，再从缓冲区开头到写位置。镜像模式下只需要一段。
+ *
+ * @return int iovec的段数，缓冲区为空时为0。
+ */
+static int ringbuffer_data_iov(const RingBuffer *rbuf, struct iovec iov[2])
+{
+    size_t size = RingBufferSize(rbuf);
+    if (size == 0)
+    {
+        return 0;
+    }
+    size_t pos = ringbuffer_tail_index(rbuf);
+    size_t first = rbuf->mirrored ? size : MIN(size, rbuf->capacity - pos);
+    iov[0].iov_base = &rbuf->buffer[pos];
+    iov[0].iov_len = first;
+    iov[1].iov_base = rbuf->buffer;
+    iov[1].iov_len = size - first;
+    return iov[1].iov_len > 0 ? 2 : 1;
+}
+
+/**
+ * @brief 从文件描述符读数据直接填进RingBuffer的空闲区域，一次readv()调用，不经过中间缓冲区。
+ *
+ * @param rbuf 指向要写入数据的RingBuffer结构体的指针。
+ * @param fd 数据来源的文件描述符。
+ * @return ssize_t 读到的字节数；0表示读到EOF；-1表示出错（errno由readv设置），缓冲区已满时也返回-1并把errno设为ENOBUFS。
+ */
+ssize_t RingBufferFillFromFd(RingBuffer *rbuf, int fd)
+{
+    struct iovec iov[2];
+    int cnt = ringbuffer_free_iov(rbuf, iov);
+    if (cnt == 0)
+    {
+        errno = ENOBUFS;
+        return -1;
+    }
+    ssize_t n;
+    do
+    {
+        n = readv(fd, iov, cnt);
+    } while (n < 0 && errno == EINTR);
+    if (n > 0)
+    {
+        RingBufferWriteCommit(rbuf, n);
+    }
+    return n;
+}
+
+/**
+ * @brief 把RingBuffer中已存储的数据直接写到文件描述符，一次writev()调用，不经过中间缓冲区。
+ *
+ * @param rbuf 指向要读取数据的RingBuffer结构体的指针。
+ * @param fd 输出目标的文件描述符。
+ * @return ssize_t 写出的字节数（可能少于已存储的数据，剩下的留在缓冲区中），缓冲区为空时返回0；-1表示出错（errno由writev设置）。
+ */
+ssize_t RingBufferDrainToFd(RingBuffer *rbuf, int fd)
+{
+    struct iovec iov[2];
+    int cnt = ringbuffer_data_iov(rbuf, iov);
+    if (cnt == 0)
+    {
+        return 0;
+    }
+    ssize_t n;
+    do
+    {
+        n = writev(fd, iov, cnt);
+    } while (n < 0 && errno == EINTR);
+    if (n > 0)
+    {
+        RingBufferConsume(rbuf, n);
+    }
+    return n;
+}
+
+#ifdef RINGBUFFER_USE_IO_URING
+/// 映射到用户空间的io_uring：提交队列、完成队列两个环和SQE数组
+typedef struct RingBufferUring
+{
+    int fd;
+    void *rings;  ///< 提交队列和完成队列共用的映射（IORING_FEAT_SINGLE_MMAP）
+    size_t ringsLen;
+    struct io_uring_sqe *sqes;
+    size_t sqesLen;
+    unsigned *sqHead, *sqTail, *sqMask, *sqArray;
+    unsigned *cqHead, *cqTail, *cqMask;
+    struct io_uring_cqe *cqes;
+} RingBufferUring;
+
+/**
+ * @brief 创建io_uring并映射它的队列。要求内核支持单次映射两个队列以及偏移-1表示文件的当前位置（Linux 5.6起）。
+ *
+ * @return bool 成功返回true；系统不支持io_uring或映射失败时返回false。
+ */
+static bool ringbuffer_uring_init(RingBufferUring *u)
+{
+    struct io_uring_params p;
+    memset(&p, 0, sizeof(p));
+    u->fd = (int)syscall(__NR_io_uring_setup, RINGBUFFER_URING_DEPTH, &p);
+    if (u->fd < 0)
+    {
+        return false;
+    }
+    const unsigned need = IORING_FEAT_SINGLE_MMAP | IORING_FEAT_RW_CUR_POS;
+    size_t sqLen = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    size_t cqLen = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    u->ringsLen = sqLen > cqLen ? sqLen : cqLen;
+    u->sqesLen = p.sq_entries * sizeof(struct io_uring_sqe);
+    u->rings = MAP_FAILED;
+    u->sqes = MAP_FAILED;
+    if ((p.features & need) == need)
+    {
+        u->rings = mmap(NULL, u->ringsLen, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, u->fd, IORING_OFF_SQ_RING);
+        u->sqes = mmap(NULL, u->sqesLen, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, u->fd, IORING_OFF_SQES);
+    }
+    if (u->rings == MAP_FAILED || u->sqes == MAP_FAILED)
+    {
+        if (u->rings != MAP_FAILED)
+        {
+            munmap(u->rings, u->ringsLen);
+        }
+        if (u->sqes != MAP_FAILED)
+        {
+            munmap(u->sqes, u->sqesLen);
+        }
+        close(u->fd);
+        return false;
+    }
+    uint8_t *r = (uint8_t *)u->rings;
+    u->sqHead = (unsigned *)(r + p.sq_off.head);
+    u->sqTail = (unsigned *)(r + p.sq_off.tail);
+    u->sqMask = (unsigned *)(r + p.sq_off.ring_mask);
+    u->sqArray = (unsigned *)(r + p.sq_off.array);
+    u->cqHead = (unsigned *)(r + p.cq_off.head);
+    u->cqTail = (unsigned *)(r + p.cq_off.tail);
+    u->cqMask = (unsigned *)(r + p.cq_off.ring_mask);
+    u->cqes = (struct io_uring_cqe *)(r + p.cq_off.cqes);
+    return true;
+}
+
+/**
+ * @brief 解除映射并关闭io_uring，内核会取消仍未完成的请求。
+ */
+static void ringbuffer_uring_exit(RingBufferUring *u)
+{
+    munmap(u->sqes, u->sqesLen);
+    munmap(u->rings, u->ringsLen);
+    close(u->fd);
+}
+
+/**
+ * @brief 调用io_uring_enter，被信号打断时重试。
+ *
+ * @return int 提交的请求个数；失败时返回-1（errno由io_uring_enter设置）。
+ */
+static int ringbuffer_uring_enter(RingBufferUring *u, unsigned toSubmit, unsigned minComplete)
+{
+    int ret;
+    do
+    {
+        ret = (int)syscall(__NR_io_uring_enter, u->fd, toSubmit, minComplete, minComplete ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+    } while (ret < 0 && errno == EINTR);
+    return ret;
+}
+
+/**
+ * @brief 用io_uring批量写出：每RINGBUFFER_URING_DEPTH个RingBuffer的writev请求一次提交，再统一收取完成事件。
+ *
+ * io_uring实例按线程延迟创建并一直复用。每一批都收齐全部完成事件后才处理下一批，因为请求引用的是本函数栈上的iovec。
+ * 内核只接收了一批中的前一部分请求时，把剩下的请求从提交队列中撤回（没有SQPOLL时内核只在io_uring_enter中读取提交队列），
+ * 收齐已接收请求的完成事件后，剩下的通道交给调用者。
+ *
+ * @return size_t 已处理（results已填写）的通道个数，调用者对其后的通道退回逐个writev。
+ */
+static size_t ringbuffer_drain_uring(RingBuffer **rbufs, const int *fds, size_t n, ssize_t *results)
+{
+    static __thread RingBufferUring uring;
+    static __thread int ready; // 0：尚未创建，1：可用，-1：创建失败或已放弃
+    if (ready == 0)
+    {
+        ready = ringbuffer_uring_init(&uring) ? 1 : -1;
+    }
+    struct iovec iov[RINGBUFFER_URING_DEPTH][2];
+    size_t order[RINGBUFFER_URING_DEPTH]; // 按提交顺序排列的通道下标
+    bool pending[RINGBUFFER_URING_DEPTH];
+    for (size_t base = 0; base < n; base += RINGBUFFER_URING_DEPTH)
+    {
+        if (ready < 0)
+        {
+            return base;
+        }
+        size_t end = MIN(n, base + RINGBUFFER_URING_DEPTH);
+        unsigned submitted = 0;
+        unsigned tail = *uring.sqTail; // 只有本线程写提交队列的尾部
+        for (size_t i = base; i < end; ++i)
+        {
+            results[i] = 0;
+            pending[i - base] = false;
+            int cnt = ringbuffer_data_iov(rbufs[i], iov[i - base]);
+            if (cnt == 0)
+            {
+                continue;
+            }
+            unsigned idx = tail & *uring.sqMask;
+            struct io_uring_sqe *sqe = &uring.sqes[idx];
+            memset(sqe, 0, sizeof(*sqe));
+            sqe->opcode = IORING_OP_WRITEV;
+            sqe->fd = fds[i];
+            sqe->addr = (uint64_t)(uintptr_t)iov[i - base];
+            sqe->len = (unsigned)cnt;
+            sqe->off = (uint64_t)-1; // 偏移-1表示使用文件的当前位置
+            sqe->user_data = i;
+            uring.sqArray[idx] = idx;
+            ++tail;
+            pending[i - base] = true;
+            order[submitted++] = i;
+        }
+        if (submitted == 0)
+        {
+            continue;
+        }
+        // release保证内核看到新的尾部时也能看到填好的SQE
+        __atomic_store_n(uring.sqTail, tail, __ATOMIC_RELEASE);
+        unsigned accepted = 0;
+        int err = 0;
+        while (accepted < submitted)
+        {
+            int ret = ringbuffer_uring_enter(&uring, submitted - accepted, submitted - accepted);
+            if (ret <= 0)
+            {
+                err = ret < 0 ? errno : EAGAIN;
+                break;
+            }
+            accepted += ret;
+        }
+        size_t stop = end; // 这一批中从stop开始的通道没有被内核接收
+        if (accepted < submitted)
+        {
+            // 撤回内核没有接收的请求，它们引用的是栈上的iovec，不能留在队列里
+            __atomic_store_n(uring.sqTail, __atomic_load_n(uring.sqHead, __ATOMIC_ACQUIRE), __ATOMIC_RELEASE);
+            stop = order[accepted];
+        }
+        unsigned head = *uring.cqHead; // 只有本线程推进完成队列的头部
+        for (unsigned done = 0; done < accepted; ++done)
+        {
+            while (head == __atomic_load_n(uring.cqTail, __ATOMIC_ACQUIRE))
+            {
+                if (ringbuffer_uring_enter(&uring, 0, 1) < 0)
+                {
+                    // 收不到剩下的完成事件：无法知道这些请求是否已写出，不能重试，报告错误并把数据留在缓冲区中；
+                    // 仍在进行的请求引用栈上的iovec，关闭io_uring让内核取消它们
+                    for (size_t i = base; i < stop; ++i)
+                    {
+                        if (pending[i - base])
+                        {
+                            results[i] = -errno;
+                        }
+                    }
+                    ringbuffer_uring_exit(&uring);
+                    ready = -1;
+                    return stop;
+                }
+            }
+            struct io_uring_cqe *cqe = &uring.cqes[head & *uring.cqMask];
+            size_t i = (size_t)cqe->user_data;
+            pending[i - base] = false;
+            results[i] = cqe->res;
+            if (cqe->res > 0)
+            {
+                RingBufferConsume(rbufs[i], cqe->res);
+            }
+            // release保证内核复用这个CQE之前已经读完它
+            __atomic_store_n(uring.cqHead, ++head, __ATOMIC_RELEASE);
+        }
+        if (accepted < submitted)
+        {
+            // 资源暂时不足（EAGAIN/EBUSY）时保留io_uring供下次使用，其余错误说明它已不可用
+            if (err != EAGAIN && err != EBUSY)
+            {
+                ringbuffer_uring_exit(&uring);
+                ready = -1;
+            }
+            return stop;
+        }
+    }
+    return n;
+}
+#endif
+
+/**
+ * @brief 批量把多个RingBuffer中的数据写到各自的文件描述符，适合一个线程负责大量转发通道的情况。
+ *
+ * 在Linux上所有请求通过io_uring成批提交，n个通道只需要很少几次系统调用；
+ * 其他系统（或内核不支持io_uring时）对每个RingBuffer依次调用RingBufferDrainToFd，io_uring中途失败时只对尚未处理的通道这样做。
+ *
+ * @param rbufs RingBuffer指针数组，长度为n。
+ * @param fds 与rbufs一一对应的输出文件描述符。
+ * @param n 通道个数，同一个文件描述符不要在一批中出现两次。
+ * @param results 输出参数，长度为n：每个通道写出的字节数，出错时为负的errno。
+ * @return size_t 这一批总共写出的字节数。
+ */
+size_t RingBufferDrainBatch(RingBuffer **rbufs, const int *fds, size_t n, ssize_t *results)
+{
+    size_t done = 0;
+#ifdef RINGBUFFER_USE_IO_URING
+    done = ringbuffer_drain_uring(rbufs, fds, n, results);
+#endif
+    for (size_t i = done; i < n; ++i)
+    {
+        results[i] = RingBufferDrainToFd(rbufs[i], fds[i]);
+        if (results[i] < 0)
+        {
+            results[i] = -errno;
+        }
+    }
+    size_t total = 0;
+    for (size_t i = 0; i < n; ++i)
+    {
+        if (results[i] > 0)
+        {
+            total += results[i];
+        }
+    }
+    return total;
+}
+
 /**
  * @brief 清除RingBuffer（环形缓冲区），释放其内部已分配的缓冲区内存，并重置相关成员变量。
  *
@@ -156,10 +727,19 @@ size_t RingBufferReadData(RingBuffer *rbuf, uint8_t *data, size_t len)
  */
 void RingBufferClear(RingBuffer *rbuf)
 {
-    free(rbuf->buffer);
+    if (rbuf->mirrored)
+    {
+        munmap(rbuf->buffer, rbuf->capacity * 2);
+    }
+    else
+    {
+        free(rbuf->buffer);
+    }
     rbuf->buffer = NULL;
     rbuf->capacity = 0;
     rbuf->head = 0;
     rbuf->tail = 0;
     rbuf->count = 0;
+    rbuf->mask = 0;
+    rbuf->mirrored = false;
 }
\ No newline at end of file
@@ -4,6 +4,11 @@
 #include <stdint.h>
 #include <stdlib.h>
 #include <stdbool.h>
+#include <sys/types.h>
+
+#ifndef RINGBUFFER_URING_DEPTH
+#define RINGBUFFER_URING_DEPTH 64 // RingBufferDrainBatch一次提交给io_uring的最多请求数
+#endif
 
 typedef struct RingBuffer_t
 {
@@ -12,10 +17,16 @@ typedef struct RingBuffer_t
     size_t head;
     size_t tail;
     size_t count;
+    size_t mask; // 2的幂模式下为capacity - 1，head/tail是单调递增的计数、count由两者相减得到；普通模式下为0
+    bool mirrored; // 镜像模式：同一组物理页被连续映射两次，任何可读/可写区域在地址上都是连续的
 } RingBuffer;
 
 RingBuffer RingBufferCreate(size_t capacity);
 
+RingBuffer RingBufferCreatePow2(size_t capacity);
+
+RingBuffer RingBufferCreateMirrored(size_t capacity);
+
 bool RingBufferIsFull(const RingBuffer *rbuf);
 
 bool RingBufferIsEmpty(const RingBuffer *rbuf);
@@ -26,6 +37,20 @@ size_t RingBufferWriteData(RingBuffer *rbuf, uint8_t *data, size_t len);
 
 size_t RingBufferReadData(RingBuffer *rbuf, uint8_t *data, size_t len);
 
+uint8_t *RingBufferWriteReserve(RingBuffer *rbuf, size_t len);
+
+void RingBufferWriteCommit(RingBuffer *rbuf, size_t len);
+
+uint8_t *RingBufferPeek(RingBuffer *rbuf, size_t *len);
+
+void RingBufferConsume(RingBuffer *rbuf, size_t len);
+
+ssize_t RingBufferFillFromFd(RingBuffer *rbuf, int fd);
+
+ssize_t RingBufferDrainToFd(RingBuffer *rbuf, int fd);
+
+size_t RingBufferDrainBatch(RingBuffer **rbufs, const int *fds, size_t n, ssize_t *results);
+
 void RingBufferClear(RingBuffer *rbuf);
 
 #endif
@@ -0,0 +1,250 @@
+/**
+ * @file BlockingRingBuffer相关操作函数的实现
+ * @brief 这个文件在SPSCRingBuffer之上实现了基于futex的阻塞等待：快速路径不进入内核，只有对方正在睡眠并且越过水位线时才发起唤醒。
+ */
+#include "ringbuffer_blocking.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <errno.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include <linux/futex.h>
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+#define MAX(a, b) ((a) > (b) ? (a) : (b))
+
+/**
+ * @brief 在futex上睡眠，直到*addr不再等于expected、被唤醒或超时。
+ *
+ * @param timeoutNs 最长睡眠时间（纳秒），为负数时一直等待。
+ */
+static void ringbuffer_futex_wait(_Atomic uint32_t *addr, uint32_t expected, int64_t timeoutNs)
+{
+    struct timespec ts, *pts = NULL;
+    if (timeoutNs >= 0)
+    {
+        ts.tv_sec = timeoutNs / 1000000000;
+        ts.tv_nsec = timeoutNs % 1000000000;
+        pts = &ts;
+    }
+    syscall(SYS_futex, (uint32_t *)addr, FUTEX_WAIT_PRIVATE, expected, pts, NULL, 0);
+}
+
+/**
+ * @brief 唤醒在futex上睡眠的线程。
+ */
+static void ringbuffer_futex_wake(_Atomic uint32_t *addr)
+{
+    atomic_fetch_add_explicit(addr, 1, memory_order_release);
+    syscall(SYS_futex, (uint32_t *)addr, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+}
+
+/**
+ * @brief 当前的单调时钟（纳秒）。
+ */
+static int64_t ringbuffer_now_ns(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+/**
+ * @brief 对方登记了睡眠且条件满足时唤醒它。
+ *
+ * 先用seq_cst栅栏把刚才对head/tail的修改与读取want的顺序固定下来，与睡眠一方“登记want、栅栏、再检查数据量”配对，
+ * 保证不会出现双方都没看到对方的情况。没有人睡眠时只有一次读操作，不进入内核。
+ */
+static void ringbuffer_wake_if(_Atomic size_t *want, _Atomic uint32_t *seq, size_t have)
+{
+    atomic_thread_fence(memory_order_seq_cst);
+    size_t need = atomic_load_explicit(want, memory_order_relaxed);
+    if (need != 0 && have >= need)
+    {
+        atomic_store_explicit(want, 0, memory_order_relaxed);
+        ringbuffer_futex_wake(seq);
+    }
+}
+
+/**
+ * @brief 睡眠等待ready(rbuf)达到need的公共实现。
+ *
+ * @param have 返回当前可用量（数据量或空闲空间）的函数。
+ * @param minBytes 调用者真正需要的量，达到即可返回。
+ * @param wakeAt 登记给对方的唤醒阈值（不小于minBytes），用来合并唤醒。
+ * @return bool 可用量达到minBytes返回true，超时返回false。
+ */
+static bool ringbuffer_wait(BlockingRingBuffer *rbuf, size_t (*have)(BlockingRingBuffer *), _Atomic size_t *want, _Atomic uint32_t *seq,
+                            size_t minBytes, size_t wakeAt, int timeoutMs)
+{
+    int64_t deadline = timeoutMs >= 0 ? ringbuffer_now_ns() + (int64_t)timeoutMs * 1000000 : -1;
+    for (;;)
+    {
+        uint32_t expected = atomic_load_explicit(seq, memory_order_acquire);
+        atomic_store_explicit(want, wakeAt, memory_order_relaxed);
+        atomic_thread_fence(memory_order_seq_cst);
+        if (have(rbuf) >= minBytes)
+        {
+            atomic_store_explicit(want, 0, memory_order_relaxed);
+            return true;
+        }
+        int64_t remain = -1;
+        if (deadline >= 0)
+        {
+            remain = deadline - ringbuffer_now_ns();
+            if (remain <= 0)
+            {
+                atomic_store_explicit(want, 0, memory_order_relaxed);
+                return false;
+            }
+        }
+        ringbuffer_futex_wait(seq, expected, remain);
+        if (have(rbuf) >= minBytes)
+        {
+            atomic_store_explicit(want, 0, memory_order_relaxed);
+            return true;
+        }
+    }
+}
+
+/**
+ * @brief 当前空闲空间（字节）。
+ */
+static size_t ringbuffer_space(BlockingRingBuffer *rbuf)
+{
+    return rbuf->ring.capacity - SPSCRingBufferSize(&rbuf->ring);
+}
+
+/**
+ * @brief 创建一个BlockingRingBuffer（可阻塞等待的单生产者/单消费者环形缓冲区）。
+ *
+ * @param rbuf 指向要初始化的BlockingRingBuffer结构体的指针，结构体本身需要按缓存行对齐。
+ * @param capacity 环形缓冲区的容量大小，以字节为单位，会向上取整为2的幂。
+ * @param lowWatermark 低水位线：等待空间的生产者要等数据量降到此值以下才被唤醒，为0时只要空间满足需要就唤醒。
+ * @param highWatermark 高水位线：等待数据的消费者要等数据量达到此值才被唤醒，为0时只要数据满足需要就唤醒。超过容量时按容量处理。
+ * @return bool 内存分配成功返回true；失败时输出错误提示信息到标准错误输出并返回false。
+ */
+bool BlockingRingBufferCreate(BlockingRingBuffer *rbuf, size_t capacity, size_t lowWatermark, size_t highWatermark)
+{
+    if (!SPSCRingBufferCreate(&rbuf->ring, capacity))
+    {
+        return false;
+    }
+    atomic_init(&rbuf->readSeq, 0);
+    atomic_init(&rbuf->readWant, 0);
+    atomic_init(&rbuf->writeSeq, 0);
+    atomic_init(&rbuf->writeWant, 0);
+    rbuf->lowWatermark = MIN(lowWatermark, capacity);
+    rbuf->highWatermark = MIN(highWatermark, capacity);
+    return true;
+}
+
+/**
+ * @brief 获取BlockingRingBuffer中当前存储的字节数。
+ *
+ * @param rbuf 指向BlockingRingBuffer结构体的指针。
+ * @return size_t 已存储的字节数。另一端并发修改时结果只是调用时刻的快照。
+ */
+size_t BlockingRingBufferSize(BlockingRingBuffer *rbuf)
+{
+    return SPSCRingBufferSize(&rbuf->ring);
+}
+
+/**
+ * @brief 向BlockingRingBuffer中写入数据，只能由生产者线程调用，不会阻塞。
+ *
+ * @param rbuf 指向要写入数据的BlockingRingBuffer结构体的指针。
+ * @param data 指向要写入的数据缓冲区的指针。
+ * @param len 要写入的数据长度（字节数）。
+ * @return size_t 实际写入的字节数，剩余空间不足时只写入能放下的部分，缓冲区已满时返回0。
+ *         消费者正在睡眠且数据量达到它的唤醒阈值时顺便唤醒它。
+ */
+size_t BlockingRingBufferWriteData(BlockingRingBuffer *rbuf, const uint8_t *data, size_t len)
+{
+    size_t n = SPSCRingBufferWriteData(&rbuf->ring, data, len);
+    if (n > 0)
+    {
+        ringbuffer_wake_if(&rbuf->readWant, &rbuf->readSeq, SPSCRingBufferSize(&rbuf->ring));
+    }
+    return n;
+}
+
+/**
+ * @brief 从BlockingRingBuffer中读取数据，只能由消费者线程调用，不会阻塞。
+ *
+ * @param rbuf 指向要读取数据的BlockingRingBuffer结构体的指针。
+ * @param data 指向用于存放读取出来的数据的缓冲区的指针。
+ * @param len 期望读取的数据长度（字节数）。
+ * @return size_t 实际读取的字节数，缓冲区为空时返回0。生产者正在睡眠且空闲空间达到它的唤醒阈值时顺便唤醒它。
+ */
+size_t BlockingRingBufferReadData(BlockingRingBuffer *rbuf, uint8_t *data, size_t len)
+{
+    size_t n = SPSCRingBufferReadData(&rbuf->ring, data, len);
+    if (n > 0)
+    {
+        ringbuffer_wake_if(&rbuf->writeWant, &rbuf->writeSeq, ringbuffer_space(rbuf));
+    }
+    return n;
+}
+
+/**
+ * @brief 等待直到至少有minBytes字节可读，只能由消费者线程调用。
+ *
+ * @param rbuf 指向BlockingRingBuffer结构体的指针。
+ * @param minBytes 需要的字节数，超过容量时按容量处理。
+ * @param timeoutMs 最长等待时间（毫秒），为负数时一直等待，为0时只检查一次。
+ * @return bool 数据已经足够返回true，超时返回false。数据已经足够时直接返回，不进入内核。
+ */
+bool BlockingRingBufferWaitReadable(BlockingRingBuffer *rbuf, size_t minBytes, int timeoutMs)
+{
+    minBytes = MAX(MIN(minBytes, rbuf->ring.capacity), 1);
+    if (SPSCRingBufferSize(&rbuf->ring) >= minBytes)
+    {
+        return true;
+    }
+    size_t wakeAt = MAX(minBytes, rbuf->highWatermark);
+    return ringbuffer_wait(rbuf, BlockingRingBufferSize, &rbuf->readWant, &rbuf->readSeq, minBytes, wakeAt, timeoutMs);
+}
+
+/**
+ * @brief 等待直到至少有minBytes字节空闲空间，只能由生产者线程调用。
+ *
+ * @param rbuf 指向BlockingRingBuffer结构体的指针。
+ * @param minBytes 需要的空闲字节数，超过容量时按容量处理。
+ * @param timeoutMs 最长等待时间（毫秒），为负数时一直等待，为0时只检查一次。
+ * @return bool 空间已经足够返回true，超时返回false。空间已经足够时直接返回，不进入内核。
+ */
+bool BlockingRingBufferWaitWritable(BlockingRingBuffer *rbuf, size_t minBytes, int timeoutMs)
+{
+    minBytes = MAX(MIN(minBytes, rbuf->ring.capacity), 1);
+    if (ringbuffer_space(rbuf) >= minBytes)
+    {
+        return true;
+    }
+    size_t wakeAt = MAX(minBytes, rbuf->ring.capacity - rbuf->lowWatermark);
+    return ringbuffer_wait(rbuf, ringbuffer_space, &rbuf->writeWant, &rbuf->writeSeq, minBytes, wakeAt, timeoutMs);
+}
+
+/**
+ * @brief 生产者暂时没有更多数据时调用：如果消费者正在等待更高的水位线，立即唤醒它处理已有的数据。
+ *
+ * @param rbuf 指向BlockingRingBuffer结构体的指针。
+ */
+void BlockingRingBufferFlush(BlockingRingBuffer *rbuf)
+{
+    ringbuffer_wake_if(&rbuf->readWant, &rbuf->readSeq, rbuf->ring.capacity);
+}
+
+/**
+ * @brief 清除BlockingRingBuffer，释放其内部缓冲区。调用时生产者和消费者都不能再访问它，也不能有线程在等待。
+ *
+ * @param rbuf 指向要清除的BlockingRingBuffer结构体的指针。
+ */
+void BlockingRingBufferClear(BlockingRingBuffer *rbuf)
+{
+    SPSCRingBufferClear(&rbuf->ring);
+    atomic_store_explicit(&rbuf->readWant, 0, memory_order_relaxed);
+    atomic_store_explicit(&rbuf->writeWant, 0, memory_order_relaxed);
+}
\ No newline at end of file
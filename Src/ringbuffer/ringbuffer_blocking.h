@@ -0,0 +1,48 @@
+#ifndef __RINGBUFFER_BLOCKING_H__
+#define __RINGBUFFER_BLOCKING_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#include "ringbuffer_spsc.h"
+
+/**
+ * @brief 可以阻塞等待的单生产者/单消费者环形缓冲区：在SPSCRingBuffer之上加两个futex，消费者可以睡眠等待数据，生产者可以睡眠等待空间。
+ *
+ * 读写本身仍然是无锁的，对方没有在睡眠时不会产生任何系统调用。为了合并唤醒，睡眠的消费者只有在数据量达到
+ * max(需要的字节数, highWatermark)时才会被唤醒，睡眠的生产者只有在数据量降到lowWatermark以下（且空闲空间满足需要）时才会被唤醒。
+ * 生产者暂时不再写入时可以调用BlockingRingBufferFlush立即唤醒消费者处理剩余的数据。
+ */
+typedef struct BlockingRingBuffer_t
+{
+    SPSCRingBuffer ring; ///< 实际存放数据的无锁环形缓冲区
+
+    _Alignas(RINGBUFFER_CACHE_LINE) _Atomic uint32_t readSeq; ///< 消费者睡眠用的futex，生产者唤醒时加一
+    _Atomic size_t readWant;                                  ///< 消费者睡眠时等待的数据量，没有睡眠时为0
+
+    _Alignas(RINGBUFFER_CACHE_LINE) _Atomic uint32_t writeSeq; ///< 生产者睡眠用的futex，消费者唤醒时加一
+    _Atomic size_t writeWant;                                  ///< 生产者睡眠时等待的空闲空间，没有睡眠时为0
+
+    size_t lowWatermark;  ///< 数据量降到此值以下才唤醒等待空间的生产者
+    size_t highWatermark; ///< 数据量达到此值才唤醒等待数据的消费者
+} BlockingRingBuffer;
+
+bool BlockingRingBufferCreate(BlockingRingBuffer *rbuf, size_t capacity, size_t lowWatermark, size_t highWatermark);
+
+size_t BlockingRingBufferSize(BlockingRingBuffer *rbuf);
+
+size_t BlockingRingBufferWriteData(BlockingRingBuffer *rbuf, const uint8_t *data, size_t len);
+
+size_t BlockingRingBufferReadData(BlockingRingBuffer *rbuf, uint8_t *data, size_t len);
+
+bool BlockingRingBufferWaitReadable(BlockingRingBuffer *rbuf, size_t minBytes, int timeoutMs);
+
+bool BlockingRingBufferWaitWritable(BlockingRingBuffer *rbuf, size_t minBytes, int timeoutMs);
+
+void BlockingRingBufferFlush(BlockingRingBuffer *rbuf);
+
+void BlockingRingBufferClear(BlockingRingBuffer *rbuf);
+
+#endif
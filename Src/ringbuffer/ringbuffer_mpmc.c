@@ -0,0 +1,234 @@
+/**
+ * @file MPMCRingBuffer相关操作函数的实现
+ * @brief 这个文件实现了基于槽位序号的多生产者/多消费者无锁环形队列，包括单个元素和批量的入队、出队操作。
+ */
+#include "ringbuffer_mpmc.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// 槽位开头的序号
+typedef _Atomic size_t MPMCRingBufferSeq;
+
+/// @brief 取位置pos对应的槽位
+static inline MPMCRingBufferSeq *mpmc_slot(MPMCRingBuffer *rbuf, size_t pos)
+{
+    return (MPMCRingBufferSeq *)(rbuf->slots + (pos & rbuf->mask) * rbuf->slotSize);
+}
+
+/// @brief 槽位中元素的地址
+static inline uint8_t *mpmc_value(MPMCRingBufferSeq *slot)
+{
+    return (uint8_t *)(slot + 1);
+}
+
+/**
+ * @brief 创建一个MPMCRingBuffer（多生产者/多消费者环形队列）。
+ *
+ * @param rbuf 指向要初始化的MPMCRingBuffer结构体的指针，结构体本身需要按缓存行对齐（静态或栈上定义会自动对齐，堆上请使用aligned_alloc）。
+ * @param capacity 最多能容纳的元素个数，会向上取整为2的幂，至少为2。
+ * @param valueSize 每个元素所占用的字节数。
+ * @return bool 内存分配成功返回true；失败时输出错误提示信息到标准错误输出并返回false。
+ */
+bool MPMCRingBufferCreate(MPMCRingBuffer *rbuf, size_t capacity, size_t valueSize)
+{
+    size_t slots = 2;
+    while (slots < capacity)
+    {
+        slots <<= 1;
+    }
+    size_t align = sizeof(MPMCRingBufferSeq);
+    rbuf->slotSize = (sizeof(MPMCRingBufferSeq) + valueSize + align - 1) / align * align;
+    rbuf->slots = (uint8_t *)malloc(slots * rbuf->slotSize);
+    if (!rbuf->slots)
+    {
+        fprintf(stderr, "Memory allocation failed for MPMCRingBuffer.\n");
+        rbuf->capacity = 0;
+        rbuf->mask = 0;
+        return false;
+    }
+    rbuf->capacity = slots;
+    rbuf->mask = slots - 1;
+    rbuf->valueSize = valueSize;
+    for (size_t i = 0; i < slots; ++i)
+    {
+        atomic_init(mpmc_slot(rbuf, i), i);
+    }
+    atomic_init(&rbuf->head, 0);
+    atomic_init(&rbuf->tail, 0);
+    return true;
+}
+
+/**
+ * @brief 判断MPMCRingBuffer是否为空。
+ *
+ * @param rbuf 指向要检查的MPMCRingBuffer结构体的指针。
+ * @return bool 为空返回true。其他线程并发操作时结果只是调用时刻的近似值。
+ */
+bool MPMCRingBufferIsEmpty(MPMCRingBuffer *rbuf)
+{
+    return MPMCRingBufferSize(rbuf) == 0;
+}
+
+/**
+ * @brief 获取MPMCRingBuffer中已入队（包括正在写入）的元素个数。
+ *
+ * @param rbuf 指向MPMCRingBuffer结构体的指针。
+ * @return size_t 元素个数。其他线程并发操作时结果只是调用时刻的近似值。
+ */
+size_t MPMCRingBufferSize(MPMCRingBuffer *rbuf)
+{
+    size_t tail = atomic_load_explicit(&rbuf->tail, memory_order_acquire);
+    size_t head = atomic_load_explicit(&rbuf->head, memory_order_acquire);
+    return head > tail ? head - tail : 0;
+}
+
+/**
+ * @brief 尝试向MPMCRingBuffer入队一个元素，可由任意多个线程同时调用。
+ *
+ * @param rbuf 指向目标MPMCRingBuffer结构体的指针。
+ * @param value 指向要入队的元素的指针，复制valueSize个字节。
+ * @return bool 入队成功返回true；队列已满时立即返回false，不会等待。
+ */
+bool MPMCRingBufferTryPush(MPMCRingBuffer *rbuf, const void *value)
+{
+    return MPMCRingBufferTryPushBatch(rbuf, value, 1) == 1;
+}
+
+/**
+ * @brief 尝试从MPMCRingBuffer出队一个元素，可由任意多个线程同时调用。
+ *
+ * @param rbuf 指向目标MPMCRingBuffer结构体的指针。
+ * @param value 指向存放出队元素的内存，至少valueSize个字节。
+ * @return bool 出队成功返回true；队列为空时立即返回false，不会等待。
+ */
+bool MPMCRingBufferTryPop(MPMCRingBuffer *rbuf, void *value)
+{
+    return MPMCRingBufferTryPopBatch(rbuf, value, 1) == 1;
+}
+
+/**
+ * @brief 尝试向MPMCRingBuffer批量入队最多n个元素，一次CAS抢占连续的多个槽位。
+ *
+ * @param rbuf 指向目标MPMCRingBuffer结构体的指针。
+ * @param values 指向连续存放的n个元素。
+ * @param n 期望入队的元素个数。
+ * @return size_t 实际入队的个数（按values中的顺序入队前若干个），队列已满时返回0。
+ */
+size_t MPMCRingBufferTryPushBatch(MPMCRingBuffer *rbuf, const void *values, size_t n)
+{
+    if (n == 0)
+    {
+        return 0;
+    }
+    size_t pos = atomic_load_explicit(&rbuf->head, memory_order_relaxed);
+    size_t count;
+    for (;;)
+    {
+        // 从pos开始数出连续空闲的槽位：序号等于位置说明上一轮的消费者已经取走了数据
+        size_t seq = 0;
+        count = 0;
+        while (count < n)
+        {
+            seq = atomic_load_explicit(mpmc_slot(rbuf, pos + count), memory_order_acquire);
+            if (seq != pos + count)
+            {
+                break;
+            }
+            ++count;
+        }
+        if (count == 0)
+        {
+            if ((intptr_t)(seq - pos) < 0)
+            {
+                return 0; // 槽位还没被上一轮的消费者取走，队列已满
+            }
+            pos = atomic_load_explicit(&rbuf->head, memory_order_relaxed); // 被其他生产者抢先了
+            continue;
+        }
+        if (atomic_compare_exchange_weak_explicit(&rbuf->head, &pos, pos + count, memory_order_relaxed, memory_order_relaxed))
+        {
+            break;
+        }
+    }
+    const uint8_t *src = (const uint8_t *)values;
+    for (size_t i = 0; i < count; ++i)
+    {
+        MPMCRingBufferSeq *slot = mpmc_slot(rbuf, pos + i);
+        memcpy(mpmc_value(slot), src + i * rbuf->valueSize, rbuf->valueSize);
+        atomic_store_explicit(slot, pos + i + 1, memory_order_release); // 数据就绪
+    }
+    return count;
+}
+
+/**
+ * @brief 尝试从MPMCRingBuffer批量出队最多n个元素，一次CAS抢占连续的多个槽位。
+ *
+ * @param rbuf 指向目标MPMCRingBuffer结构体的指针。
+ * @param values 指向存放出队元素的内存，至少n * valueSize个字节。
+ * @param n 期望出队的元素个数。
+ * @return size_t 实际出队的个数，按入队顺序存放在values中，队列为空时返回0。
+ */
+size_t MPMCRingBufferTryPopBatch(MPMCRingBuffer *rbuf, void *values, size_t n)
+{
+    if (n == 0)
+    {
+        return 0;
+    }
+    size_t pos = atomic_load_explicit(&rbuf->tail, memory_order_relaxed);
+    size_t count;
+    for (;;)
+    {
+        // 从pos开始数出连续就绪的槽位：序号等于位置+1说明生产者已经写完数据
+        size_t seq = 0;
+        count = 0;
+        while (count < n)
+        {
+            seq = atomic_load_explicit(mpmc_slot(rbuf, pos + count), memory_order_acquire);
+            if (seq != pos + count + 1)
+            {
+                break;
+            }
+            ++count;
+        }
+        if (count == 0)
+        {
+            if ((intptr_t)(seq - (pos + 1)) < 0)
+            {
+                return 0; // 槽位还没有数据，队列为空
+            }
+            pos = atomic_load_explicit(&rbuf->tail, memory_order_relaxed); // 被其他消费者抢先了
+            continue;
+        }
+        if (atomic_compare_exchange_weak_explicit(&rbuf->tail, &pos, pos + count, memory_order_relaxed, memory_order_relaxed))
+        {
+            break;
+        }
+    }
+    uint8_t *dst = (uint8_t *)values;
+    for (size_t i = 0; i < count; ++i)
+    {
+        MPMCRingBufferSeq *slot = mpmc_slot(rbuf, pos + i);
+        memcpy(dst + i * rbuf->valueSize, mpmc_value(slot), rbuf->valueSize);
+        atomic_store_explicit(slot, pos + i + rbuf->capacity, memory_order_release); // 槽位留给下一轮的生产者
+    }
+    return count;
+}
+
+/**
+ * @brief 清除MPMCRingBuffer，释放槽位数组并重置各成员。调用时不能再有其他线程访问它。
+ *
+ * @param rbuf 指向要清除的MPMCRingBuffer结构体的指针。
+ */
+void MPMCRingBufferClear(MPMCRingBuffer *rbuf)
+{
+    free(rbuf->slots);
+    rbuf->slots = NULL;
+    rbuf->capacity = 0;
+    rbuf->mask = 0;
+    rbuf->valueSize = 0;
+    rbuf->slotSize = 0;
+    atomic_store_explicit(&rbuf->head, 0, memory_order_relaxed);
+    atomic_store_explicit(&rbuf->tail, 0, memory_order_relaxed);
+}
\ No newline at end of file
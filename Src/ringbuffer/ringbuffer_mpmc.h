@@ -0,0 +1,48 @@
+#ifndef __RINGBUFFER_MPMC_H__
+#define __RINGBUFFER_MPMC_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#ifndef RINGBUFFER_CACHE_LINE
+#define RINGBUFFER_CACHE_LINE 64 // 缓存行大小，生产者与消费者各自的字段分开放置以避免伪共享
+#endif
+
+/**
+ * @brief 有界的多生产者/多消费者无锁环形队列，元素是固定大小的槽位。
+ *
+ * 每个槽位带一个序号（Vyukov式）：序号等于入队位置时槽位空闲，等于入队位置+1时数据就绪。
+ * 生产者和消费者各自用一次CAS抢占head/tail上的位置，然后只在抢到的槽位上读写，不需要锁。
+ * 容量会向上取整为2的幂，用掩码代替取模。
+ */
+typedef struct MPMCRingBuffer_t
+{
+    _Alignas(RINGBUFFER_CACHE_LINE) _Atomic size_t head; ///< 下一个入队位置，生产者共享
+    _Alignas(RINGBUFFER_CACHE_LINE) _Atomic size_t tail; ///< 下一个出队位置，消费者共享
+
+    _Alignas(RINGBUFFER_CACHE_LINE) uint8_t *slots; ///< 槽位数组，每个槽位是序号后跟一个元素
+    size_t capacity;                                ///< 槽位个数（2的幂）
+    size_t mask;                                    ///< capacity - 1
+    size_t valueSize;                               ///< 每个元素的字节数
+    size_t slotSize;                                ///< 每个槽位的字节数（序号 + 元素，按序号对齐）
+} MPMCRingBuffer;
+
+bool MPMCRingBufferCreate(MPMCRingBuffer *rbuf, size_t capacity, size_t valueSize);
+
+bool MPMCRingBufferIsEmpty(MPMCRingBuffer *rbuf);
+
+size_t MPMCRingBufferSize(MPMCRingBuffer *rbuf);
+
+bool MPMCRingBufferTryPush(MPMCRingBuffer *rbuf, const void *value);
+
+bool MPMCRingBufferTryPop(MPMCRingBuffer *rbuf, void *value);
+
+size_t MPMCRingBufferTryPushBatch(MPMCRingBuffer *rbuf, const void *values, size_t n);
+
+size_t MPMCRingBufferTryPopBatch(MPMCRingBuffer *rbuf, void *values, size_t n);
+
+void MPMCRingBufferClear(MPMCRingBuffer *rbuf);
+
+#endif
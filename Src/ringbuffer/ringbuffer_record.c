@@ -0,0 +1,198 @@
+/**
+ * @file RecordRing相关操作函数的实现
+ * @brief 这个文件实现了带长度头部的变长记录环，包括写入、覆盖最旧记录以及批量取出等功能。
+ */
+#include "ringbuffer_record.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define RECORDRING_PAD 0x1u // 填充记录：只用来跳过缓冲区末尾放不下的空间，不交给调用者
+
+/// 记录头部，后面紧跟len字节数据，再补齐到RECORDRING_ALIGN
+typedef struct RecordRingHeader
+{
+    uint32_t len;   // 数据长度（填充记录为填充的字节数，不含头部）
+    uint32_t flags; // RECORDRING_PAD等标志
+} RecordRingHeader;
+
+/**
+ * @brief 一条数据长度为len的记录在环形缓冲区中占用的字节数。
+ */
+static size_t recordring_size(size_t len)
+{
+    return sizeof(RecordRingHeader) + (len + RECORDRING_ALIGN - 1) / RECORDRING_ALIGN * RECORDRING_ALIGN;
+}
+
+/**
+ * @brief 丢弃最旧的一条记录（连同它前面的填充记录）。
+ */
+static void recordring_drop_oldest(RecordRing *rring)
+{
+    for (;;)
+    {
+        size_t avail;
+        RecordRingHeader *hdr = (RecordRingHeader *)RingBufferPeek(&rring->ring, &avail);
+        if (hdr == NULL)
+        {
+            return;
+        }
+        RingBufferConsume(&rring->ring, recordring_size(hdr->len));
+        if (!(hdr->flags & RECORDRING_PAD))
+        {
+            rring->records--;
+            rring->dropped++;
+            return;
+        }
+    }
+}
+
+/**
+ * @brief 创建一个RecordRing（变长记录环）。
+ *
+ * @param rring 指向要初始化的RecordRing结构体的指针。
+ * @param capacity 环形缓冲区的容量大小（字节），会向上取整为2的幂（镜像模式下不小于页大小）。
+ * @param overwrite 为true时空间不足则丢弃最旧的记录；为false时空间不足则写入失败。
+ * @return bool 内存分配成功返回true；失败时输出错误提示信息到标准错误输出并返回false。
+ */
+bool RecordRingCreate(RecordRing *rring, size_t capacity, bool overwrite)
+{
+    rring->ring = RingBufferCreateMirrored(capacity);
+    if (!rring->ring.buffer)
+    {
+        rring->ring = RingBufferCreatePow2(capacity < RECORDRING_ALIGN * 2 ? RECORDRING_ALIGN * 2 : capacity);
+    }
+    if (!rring->ring.buffer)
+    {
+        fprintf(stderr, "Memory allocation failed for RecordRing.\n");
+        return false;
+    }
+    rring->overwrite = overwrite;
+    rring->records = 0;
+    rring->dropped = 0;
+    return true;
+}
+
+/**
+ * @brief 获取RecordRing中当前存储的记录条数。
+ *
+ * @param rring 指向RecordRing结构体的指针。
+ * @return size_t 记录条数。
+ */
+size_t RecordRingCount(const RecordRing *rring)
+{
+    return rring->records;
+}
+
+/**
+ * @brief 获取覆盖模式下累计丢弃的最旧记录条数。
+ *
+ * @param rring 指向RecordRing结构体的指针。
+ * @return size_t 丢弃的记录条数。
+ */
+size_t RecordRingDropped(const RecordRing *rring)
+{
+    return rring->dropped;
+}
+
+/**
+ * @brief 向RecordRing写入一条记录。
+ *
+ * @param rring 指向目标RecordRing结构体的指针。
+ * @param data 指向记录数据的指针。
+ * @param len 记录数据的长度（字节数），可以为0。
+ * @return bool 写入成功返回true；单条记录（含头部和对齐）超过容量，或非覆盖模式下空间不足时返回false。
+ */
+bool RecordRingPush(RecordRing *rring, const void *data, size_t len)
+{
+    size_t total = recordring_size(len);
+    if (total > rring->ring.capacity || len > UINT32_MAX)
+    {
+        return false;
+    }
+    uint8_t *dst;
+    while ((dst = RingBufferWriteReserve(&rring->ring, total)) == NULL)
+    {
+        if (!rring->ring.mirrored && RingBufferSize(&rring->ring) == 0)
+        {
+            // 缓冲区已空但写位置在中间，两侧的连续空间可能都放不下：回到开头，整个容量都是连续的
+            rring->ring.head = 0;
+            rring->ring.tail = 0;
+            continue;
+        }
+        // 非镜像模式下末尾连续的空间不够：剩余空间足够时用填充记录跳到缓冲区开头
+        size_t space_left = rring->ring.capacity - RingBufferSize(&rring->ring);
+        size_t to_end = rring->ring.capacity - (rring->ring.head & rring->ring.mask);
+        if (!rring->ring.mirrored && space_left >= to_end + total)
+        {
+            RecordRingHeader *pad = (RecordRingHeader *)RingBufferWriteReserve(&rring->ring, to_end);
+            pad->len = to_end - sizeof(RecordRingHeader);
+            pad->flags = RECORDRING_PAD;
+            RingBufferWriteCommit(&rring->ring, to_end);
+            continue;
+        }
+        if (!rring->overwrite)
+        {
+            return false;
+        }
+        recordring_drop_oldest(rring);
+    }
+    RecordRingHeader *hdr = (RecordRingHeader *)dst;
+    hdr->len = len;
+    hdr->flags = 0;
+    memcpy(dst + sizeof(RecordRingHeader), data, len);
+    RingBufferWriteCommit(&rring->ring, total);
+    rring->records++;
+    return true;
+}
+
+/**
+ * @brief 批量取出记录：按写入顺序对每条记录调用callback，处理完的记录一并释放。
+ *
+ * @param rring 指向目标RecordRing结构体的指针。
+ * @param callback 对每条记录调用的回调，收到的指针直接指向环形缓冲区，回调中不能再操作这个RecordRing。
+ * @param ctx 原样传给callback的参数。
+ * @param maxRecords 最多取出的记录条数，为0时取出全部记录。
+ * @return size_t 实际取出的记录条数。
+ */
+size_t RecordRingPopBatch(RecordRing *rring, RecordRingCallback callback, void *ctx, size_t maxRecords)
+{
+    size_t popped = 0;
+    while (maxRecords == 0 || popped < maxRecords)
+    {
+        size_t avail;
+        uint8_t *p = RingBufferPeek(&rring->ring, &avail);
+        if (p == NULL)
+        {
+            break;
+        }
+        // 在这一段连续的数据上依次处理记录，最后只调用一次Consume
+        size_t used = 0;
+        while (used < avail && (maxRecords == 0 || popped < maxRecords))
+        {
+            RecordRingHeader *hdr = (RecordRingHeader *)(p + used);
+            if (!(hdr->flags & RECORDRING_PAD))
+            {
+                callback(ctx, p + used + sizeof(RecordRingHeader), hdr->len);
+                popped++;
+            }
+            used += recordring_size(hdr->len);
+        }
+        RingBufferConsume(&rring->ring, used);
+    }
+    rring->records -= popped;
+    return popped;
+}
+
+/**
+ * @brief 清除RecordRing，释放其内部缓冲区并重置计数。
+ *
+ * @param rring 指向要清除的RecordRing结构体的指针。
+ */
+void RecordRingClear(RecordRing *rring)
+{
+    RingBufferClear(&rring->ring);
+    rring->records = 0;
+    rring->dropped = 0;
+}
\ No newline at end of file
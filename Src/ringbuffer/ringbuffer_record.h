@@ -0,0 +1,42 @@
+#ifndef __RINGBUFFER_RECORD_H__
+#define __RINGBUFFER_RECORD_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+
+#include "ringbuffer.h"
+
+#define RECORDRING_ALIGN 8 // 每条记录（头部+数据）按8字节对齐
+
+/// 批量取出记录时对每条记录调用的回调：data指向环形缓冲区中的数据本身，只在回调期间有效
+typedef void (*RecordRingCallback)(void *ctx, const uint8_t *data, size_t len);
+
+/**
+ * @brief 变长记录环：在RingBuffer之上给每条记录加上长度头部并按8字节对齐，读取时总是得到完整的记录。
+ *
+ * 底层优先使用镜像模式的RingBuffer，任何记录在地址上都是连续的，回调可以直接在缓冲区里解析；
+ * 镜像模式不可用时退回2的幂模式，放不下的记录前用一条填充记录跳到缓冲区开头。
+ * 开启覆盖模式后，空间不足时丢弃最旧的记录，写入永远不会失败（只要单条记录不超过容量），适合飞行记录器式的遥测数据。
+ */
+typedef struct RecordRing_t
+{
+    RingBuffer ring; // 存放记录的环形缓冲区
+    bool overwrite;  // 空间不足时是否丢弃最旧的记录
+    size_t records;  // 当前存储的记录条数
+    size_t dropped;  // 覆盖模式下累计丢弃的记录条数
+} RecordRing;
+
+bool RecordRingCreate(RecordRing *rring, size_t capacity, bool overwrite);
+
+size_t RecordRingCount(const RecordRing *rring);
+
+size_t RecordRingDropped(const RecordRing *rring);
+
+bool RecordRingPush(RecordRing *rring, const void *data, size_t len);
+
+size_t RecordRingPopBatch(RecordRing *rring, RecordRingCallback callback, void *ctx, size_t maxRecords);
+
+void RecordRingClear(RecordRing *rring);
+
+#endif
@@ -0,0 +1,179 @@
+/**
+ * @file SPSCRingBuffer相关操作函数的实现
+ * @brief 这个文件实现了单生产者/单消费者的无锁环形缓冲区：生产者线程调用WriteData，消费者线程调用ReadData，两者之间只通过head/tail的acquire/release同步。
+ */
+#include "ringbuffer_spsc.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MIN(a, b) ((a) < (b) ? (a) : (b))
+
+/**
+ * @brief 创建一个SPSCRingBuffer（单生产者/单消费者环形缓冲区）。
+ *
+ * @param rbuf 指向要初始化的SPSCRingBuffer结构体的指针，结构体本身需要按缓存行对齐（静态或栈上定义会自动对齐，堆上请使用aligned_alloc）。
+ * @param capacity 环形缓冲区的容量大小，以字节为单位，会向上取整为2的幂。
+ * @return bool 内存分配成功返回true；失败时输出错误提示信息到标准错误输出并返回false。
+ */
+bool SPSCRingBufferCreate(SPSCRingBuffer *rbuf, size_t capacity)
+{
+    // 容量取2的幂，读写位置用mask取低位，不需要整数除法，计数器在size_t回绕时位置也保持连续
+    size_t size = 1;
+    while (size < capacity)
+    {
+        size <<= 1;
+    }
+    rbuf->buffer = capacity > 0 ? (uint8_t *)malloc(size) : NULL;
+    if (!rbuf->buffer)
+    {
+        fprintf(stderr, "Memory allocation failed for SPSCRingBuffer.\n");
+        rbuf->capacity = 0;
+        rbuf->mask = 0;
+        return false;
+    }
+    rbuf->capacity = size;
+    rbuf->mask = size - 1;
+    atomic_init(&rbuf->head, 0);
+    atomic_init(&rbuf->tail, 0);
+    rbuf->cachedHead = 0;
+    rbuf->cachedTail = 0;
+    return true;
+}
+
+/**
+ * @brief 判断SPSCRingBuffer是否已满。
+ *
+ * @param rbuf 指向要检查的SPSCRingBuffer结构体的指针。
+ * @return bool 已满返回true。另一端并发修改时结果只是调用时刻的快照。
+ */
+bool SPSCRingBufferIsFull(SPSCRingBuffer *rbuf)
+{
+    return SPSCRingBufferSize(rbuf) == rbuf->capacity;
+}
+
+/**
+ * @brief 判断SPSCRingBuffer是否为空。
+ *
+ * @param rbuf 指向要检查的SPSCRingBuffer结构体的指针。
+ * @return bool 为空返回true。另一端并发修改时结果只是调用时刻的快照。
+ */
+bool SPSCRingBufferIsEmpty(SPSCRingBuffer *rbuf)
+{
+    return SPSCRingBufferSize(rbuf) == 0;
+}
+
+/**
+ * @brief 获取SPSCRingBuffer中当前存储的字节数。
+ *
+ * @param rbuf 指向SPSCRingBuffer结构体的指针。
+ * @return size_t 已存储的字节数。另一端并发修改时结果只是调用时刻的快照。
+ */
+size_t SPSCRingBufferSize(SPSCRingBuffer *rbuf)
+{
+    size_t tail = atomic_load_explicit(&rbuf->tail, memory_order_acquire);
+    size_t head = atomic_load_explicit(&rbuf->head, memory_order_acquire);
+    return head - tail;
+}
+
+/**
+ * @brief 向SPSCRingBuffer中写入数据，只能由生产者线程调用。
+ *
+ * @param rbuf 指向要写入数据的SPSCRingBuffer结构体的指针。
+ * @param data 指向要写入的数据缓冲区的指针。
+ * @param len 要写入的数据长度（字节数）。
+ * @return size_t 实际写入的字节数，剩余空间不足时只写入能放下的部分，缓冲区已满时返回0。
+ */
+size_t SPSCRingBufferWriteData(SPSCRingBuffer *rbuf, const uint8_t *data, size_t len)
+{
+    size_t head = atomic_load_explicit(&rbuf->head, memory_order_relaxed);
+    size_t space_left = rbuf->capacity - (head - rbuf->cachedTail);
+    if (space_left < len)
+    {
+        // 缓存的读位置显示空间不够，重新读取消费者的位置
+        rbuf->cachedTail = atomic_load_explicit(&rbuf->tail, memory_order_acquire);
+        space_left = rbuf->capacity - (head - rbuf->cachedTail);
+        if (space_left == 0)
+        {
+            return 0;
+        }
+    }
+    size_t bytes_to_write = MIN(len, space_left);
+    size_t pos = head & rbuf->mask;
+    size_t bytes_to_end = rbuf->capacity - pos;
+
+    if (bytes_to_write <= bytes_to_end)
+    {
+        memcpy(&rbuf->buffer[pos], data, bytes_to_write);
+    }
+    else
+    {
+        memcpy(&rbuf->buffer[pos], data, bytes_to_end);
+        // 绕一圈，从头开始继续写入
+        memcpy(rbuf->buffer, data + bytes_to_end, bytes_to_write - bytes_to_end);
+    }
+
+    // release保证消费者看到新的head时也能看到写入的数据
+    atomic_store_explicit(&rbuf->head, head + bytes_to_write, memory_order_release);
+    return bytes_to_write;
+}
+
+/**
+ * @brief 从SPSCRingBuffer中读取数据，只能由消费者线程调用。
+ *
+ * @param rbuf 指向要读取数据的SPSCRingBuffer结构体的指针。
+ * @param data 指向用于存放读取出来的数据的缓冲区的指针。
+ * @param len 期望读取的数据长度（字节数）。
+ * @return size_t 实际读取的字节数，已存储的数据不足len时只读取现有的部分，缓冲区为空时返回0。
+ */
+size_t SPSCRingBufferReadData(SPSCRingBuffer *rbuf, uint8_t *data, size_t len)
+{
+    size_t tail = atomic_load_explicit(&rbuf->tail, memory_order_relaxed);
+    size_t available = rbuf->cachedHead - tail;
+    if (available < len)
+    {
+        // 缓存的写位置显示数据不够，重新读取生产者的位置
+        rbuf->cachedHead = atomic_load_explicit(&rbuf->head, memory_order_acquire);
+        available = rbuf->cachedHead - tail;
+        if (available == 0)
+        {
+            return 0;
+        }
+    }
+    size_t bytes_to_read = MIN(len, available);
+    size_t pos = tail & rbuf->mask;
+    size_t bytes_to_end = rbuf->capacity - pos;
+
+    if (bytes_to_read <= bytes_to_end)
+    {
+        memcpy(data, &rbuf->buffer[pos], bytes_to_read);
+    }
+    else
+    {
+        memcpy(data, &rbuf->buffer[pos], bytes_to_end);
+        // 绕一圈，从头开始继续读取
+        memcpy(data + bytes_to_end, rbuf->buffer, bytes_to_read - bytes_to_end);
+    }
+
+    // release保证生产者看到新的tail时这段数据已经读完，可以被覆盖
+    atomic_store_explicit(&rbuf->tail, tail + bytes_to_read, memory_order_release);
+    return bytes_to_read;
+}
+
+/**
+ * @brief 清除SPSCRingBuffer，释放其内部缓冲区并重置读写位置。调用时生产者和消费者都不能再访问它。
+ *
+ * @param rbuf 指向要清除的SPSCRingBuffer结构体的指针。
+ */
+void SPSCRingBufferClear(SPSCRingBuffer *rbuf)
+{
+    free(rbuf->buffer);
+    rbuf->buffer = NULL;
+    rbuf->capacity = 0;
+    rbuf->mask = 0;
+    atomic_store_explicit(&rbuf->head, 0, memory_order_relaxed);
+    atomic_store_explicit(&rbuf->tail, 0, memory_order_relaxed);
+    rbuf->cachedHead = 0;
+    rbuf->cachedTail = 0;
+}
\ No newline at end of file
@@ -0,0 +1,46 @@
+#ifndef __RINGBUFFER_SPSC_H__
+#define __RINGBUFFER_SPSC_H__
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <stdbool.h>
+#include <stdatomic.h>
+
+#ifndef RINGBUFFER_CACHE_LINE
+#define RINGBUFFER_CACHE_LINE 64 // 缓存行大小，生产者与消费者各自的字段分开放置以避免伪共享
+#endif
+
+/**
+ * @brief 单生产者/单消费者的无锁环形缓冲区：一个线程只写、另一个线程只读时不需要加锁。
+ *
+ * head和tail都是单调递增的字节计数，容量为2的幂，用mask取低位就是缓冲区中的位置，两者之差就是已存储的字节数，
+ * 因此不需要两端都要修改的count。每一端把对方的位置缓存在自己的缓存行里，只有缓存的值显示空间（或数据）不够时才重新读取对方的原子变量。
+ */
+typedef struct SPSCRingBuffer_t
+{
+    _Alignas(RINGBUFFER_CACHE_LINE) _Atomic size_t head; ///< 写位置，只由生产者修改
+    size_t cachedTail;                                   ///< 生产者缓存的读位置
+
+    _Alignas(RINGBUFFER_CACHE_LINE) _Atomic size_t tail; ///< 读位置，只由消费者修改
+    size_t cachedHead;                                   ///< 消费者缓存的写位置
+
+    _Alignas(RINGBUFFER_CACHE_LINE) uint8_t *buffer; ///< 数据区，创建后只读
+    size_t capacity;                                 ///< 容量（字节），2的幂
+    size_t mask;                                     ///< capacity - 1
+} SPSCRingBuffer;
+
+bool SPSCRingBufferCreate(SPSCRingBuffer *rbuf, size_t capacity);
+
+bool SPSCRingBufferIsFull(SPSCRingBuffer *rbuf);
+
+bool SPSCRingBufferIsEmpty(SPSCRingBuffer *rbuf);
+
+size_t SPSCRingBufferSize(SPSCRingBuffer *rbuf);
+
+size_t SPSCRingBufferWriteData(SPSCRingBuffer *rbuf, const uint8_t *data, size_t len);
+
+size_t SPSCRingBufferReadData(SPSCRingBuffer *rbuf, uint8_t *data, size_t len);
+
+void SPSCRingBufferClear(SPSCRingBuffer *rbuf);
+
+#endif
@@ -17,17 +17,66 @@
  * @return bool 如果内存分配成功，完成栈的创建及初始化工作，返回`true`；若内存分配失败，则输出错误提示信息到标准错误输出，并返回`false`。
  */
 bool StackCreate(Stack *this, size_t size, size_t valueSize)
+{
+    AllocatorOptions options = {0};
+    if (!StackCreateWithOptions(this, size, valueSize, &options))
+    {
+        return false;
+    }
+    if (this->data != NULL)
+    {
+        memset(this->data, 0, valueSize * size);
+    }
+    return true;
+}
+
+/**
+ * @brief 按指定的分配方式创建栈，之后的扩容和释放都沿用这组选项。
+ *
+ * @param this 指向要创建的栈结构体的指针。
+ * @param size 栈的初始容量（元素个数），可以为`0`。
+ * @param valueSize 元素大小。
+ * @param options 分配方式：对齐字节数、是否使用大页、达到多少字节改用mmap/mremap，以及新分配的内存是否清零（与StackCreate不同，默认不清零）。
+ * @return bool 如果内存分配成功返回`true`；失败时输出错误提示信息到标准错误输出，并返回`false`。
+ */
+bool StackCreateWithOptions(Stack *this, size_t size, size_t valueSize, const AllocatorOptions *options)
 {
     this->size = size;
     this->valueSize = valueSize;
-    this->data = malloc(valueSize * size);
-    if (this->data == NULL)
+    this->inlineData = false;
+    this->alloc = *options;
+    this->len = 0;
+    if (valueSize != 0 && size > SIZE_MAX / valueSize)
     {
         fprintf(stderr, "Memory allocation failed for stack data.\n");
         return false;
     }
-    memset(this->data, 0, valueSize * size);
+    this->data = AllocatorAlloc(&this->alloc, valueSize * size);
+    if (this->data == NULL && valueSize * size > 0)
+    {
+        fprintf(stderr, "Memory allocation failed for stack data.\n");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief 用调用者提供的内联存储创建一个栈，不分配内存也不清零，元素个数超过内联容量时才搬到堆上。
+ *
+ * @param this 指向要创建的栈结构体的指针。
+ * @param storage 内联存储的起始地址，至少能容纳size个元素，生命周期必须覆盖栈的整个使用期间；通常用STACK_INLINE和STACK_INLINE_INIT把它和栈放在同一个结构体里。
+ * @param size 内联存储能容纳的元素个数。
+ * @param valueSize 每个元素所占用的字节数。
+ * @return bool 总是返回`true`，与StackCreate保持一致的调用方式。
+ */
+bool StackCreateInline(Stack *this, void *storage, size_t size, size_t valueSize)
+{
+    this->size = size;
     this->len = 0;
+    this->valueSize = valueSize;
+    this->data = storage;
+    this->inlineData = true;
+    memset(&this->alloc, 0, sizeof(this->alloc));
     return true;
 }
 
@@ -36,11 +85,42 @@ bool StackCreate(Stack *this, size_t size, size_t valueSize)
  *
  * @param this 指向要扩容的栈结构体的指针，通过该指针获取当前栈的相关信息，并在扩容成功后更新栈的成员变量。
  * @param newSize 新的栈大小，即扩容后栈最多能容纳的元素个数，新大小应大于当前栈的大小才能实现有效的扩容。
- * @return bool 如果内存重新分配（`realloc`操作）成功，更新栈的相关成员变量并返回`true`；若内存重新分配失败，则输出错误提示信息到标准错误输出，并返回`false`。
+ * @return bool 如果内存重新分配（`realloc`操作，按创建时的分配方式可能是`mremap`）成功，更新栈的相关成员变量并返回`true`；若内存重新分配失败，则输出错误提示信息到标准错误输出，并返回`false`。使用内联存储的栈会被搬到新分配的堆内存上。
  */
 bool StackResize(Stack *this, size_t newSize)
 {
-    void *newData = realloc(this->data, newSize * this->valueSize);
+    if (this->valueSize != 0 && newSize > SIZE_MAX / this->valueSize)
+    {
+        fprintf(stderr, "Memory reallocation failed.\n");
+        return false;
+    }
+    if (this->inlineData)
+    {
+        // 内联存储不能realloc：搬到新分配的堆内存上，之后就和普通栈一样
+        void *heapData = AllocatorAlloc(&this->alloc, newSize * this->valueSize);
+        if (heapData == NULL && newSize > 0)
+        {
+            fprintf(stderr, "Memory reallocation failed.\n");
+            return false;
+        }
+        if (heapData != NULL)
+        {
+            memcpy(heapData, this->data, (this->len < newSize ? this->len : newSize) * this->valueSize);
+        }
+        this->data = heapData;
+        this->size = newSize;
+        this->inlineData = false;
+        return true;
+    }
+    size_t oldBytes = this->size * this->valueSize, newBytes = newSize * this->valueSize;
+    if (newBytes == 0)
+    {
+        AllocatorFree(&this->alloc, this->data, oldBytes);
+        this->data = NULL;
+        this->size = newSize;
+        return true;
+    }
+    void *newData = AllocatorRealloc(&this->alloc, this->data, oldBytes, newBytes);
     if (newData == NULL)
     {
         fprintf(stderr, "Memory reallocation failed.\n");
@@ -63,7 +143,7 @@ bool StackPush(Stack *this, void *value)
     if (this->len == this->size)
     {
         // 自动扩容
-        size_t newSize = this->size * 2; // 扩大两倍
+        size_t newSize = this->size > 0 ? this->size * 2 : STACK_MIN_GROW_SIZE; // 扩大两倍
         if (!StackResize(this, newSize))
         {
             // 如果扩容失败，返回 false
@@ -150,7 +230,11 @@ void StackDelete(Stack *this)
 {
     if (this->data != NULL)
     {
-        free(this->data);
+        if (!this->inlineData)
+        {
+            AllocatorFree(&this->alloc, this->data, this->size * this->valueSize);
+        }
+        this->inlineData = false;
         this->data = NULL;
         this->size = 0;
         this->len = 0;
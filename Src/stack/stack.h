@@ -3,15 +3,38 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stddef.h>
+
+#include "../allocator/allocator.h"
+
+#define STACK_MIN_GROW_SIZE 4 // 从空栈扩容时的最小容量
 
 typedef struct Stack
 {
     size_t size, len, valueSize;
     void *data;
+    bool inlineData;        // data指向调用者提供的内联存储（StackCreateInline），不能free
+    AllocatorOptions alloc; // 堆上存储的分配方式（对齐、大页、mmap阈值、是否清零）
 } Stack;
 
+/// 带N个元素内联存储的栈：前N个元素存放在结构体内部，超出时才搬到堆上。
+/// 用STACK_INLINE_INIT初始化，之后对.stack调用任何Stack函数；data指向结构体自身，初始化后不能再按值复制或移动它。
+#define STACK_INLINE(T, N) \
+    struct                 \
+    {                      \
+        Stack stack;       \
+        T storage[N];      \
+    }
+
+#define STACK_INLINE_INIT(s) \
+    StackCreateInline(&(s)->stack, (s)->storage, sizeof((s)->storage) / sizeof((s)->storage[0]), sizeof((s)->storage[0]))
+
 bool StackCreate(Stack *this, size_t size, size_t valueSize);
 
+bool StackCreateWithOptions(Stack *this, size_t size, size_t valueSize, const AllocatorOptions *options);
+
+bool StackCreateInline(Stack *this, void *storage, size_t size, size_t valueSize);
+
 bool StackResize(Stack *this, size_t newSize);
 
 bool StackPush(Stack *this, void *value);
@@ -0,0 +1,193 @@
+/**
+ * @file ThreadPool相关操作函数的实现
+ * @brief 这个文件实现了一个常驻的fork-join线程池：工作线程在条件变量上睡眠，每批任务只唤醒一次，任务下标用原子计数器分发。
+ */
+#include "thread_pool.h"
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <unistd.h>
+
+/// 当前线程正在为哪个线程池执行任务，用于把嵌套的ThreadPoolRun改为串行执行
+static __thread ThreadPool *thread_pool_current = NULL;
+
+/**
+ * @brief 不断领取任务下标并执行，直到领完。
+ */
+static void thread_pool_work(ThreadPool *pool, ThreadPoolTask task, void *arg, size_t tasks)
+{
+    size_t i;
+    while ((i = __atomic_fetch_add(&pool->next, 1, __ATOMIC_RELAXED)) < tasks)
+        task(arg, i);
+}
+
+/**
+ * @brief 工作线程主循环：等待新的一批任务，参与执行，离开时登记，最后一个离开的线程唤醒调用者。
+ */
+static void *thread_pool_main(void *arg)
+{
+    ThreadPool *pool = (ThreadPool *)arg;
+    thread_pool_current = pool;
+    uint64_t seen = 0;
+    pthread_mutex_lock(&pool->lock);
+    for (;;)
+    {
+        while (!pool->stop && pool->generation == seen)
+            pthread_cond_wait(&pool->wake, &pool->lock);
+        if (pool->stop)
+            break;
+        seen = pool->generation;
+        ThreadPoolTask task = pool->task;
+        void *taskArg = pool->arg;
+        size_t tasks = pool->tasks;
+        pool->active++;
+        pthread_mutex_unlock(&pool->lock);
+
+        thread_pool_work(pool, task, taskArg, tasks);
+
+        pthread_mutex_lock(&pool->lock);
+        if (--pool->active == 0)
+            pthread_cond_broadcast(&pool->idle);
+    }
+    pthread_mutex_unlock(&pool->lock);
+    return NULL;
+}
+
+/**
+ * @brief 创建线程池并启动工作线程。
+ *
+ * @param pool 指向要创建的线程池的指针。
+ * @param threads 并行度（包括调用ThreadPoolRun的线程），为0时使用在线的CPU核数；实际启动threads-1个工作线程。
+ * @note 部分工作线程创建失败时按已创建的个数继续工作。
+ * @return bool 成功返回true；内存分配失败返回false，此时线程池没有工作线程，ThreadPoolRun在调用线程上串行执行，仍需调用ThreadPoolDelete。
+ */
+bool ThreadPoolCreate(ThreadPool *pool, size_t threads)
+{
+    if (threads == 0)
+    {
+        long online = sysconf(_SC_NPROCESSORS_ONLN);
+        threads = online > 0 ? (size_t)online : 1;
+    }
+    pthread_mutex_init(&pool->runLock, NULL);
+    pthread_mutex_init(&pool->lock, NULL);
+    pthread_cond_init(&pool->wake, NULL);
+    pthread_cond_init(&pool->idle, NULL);
+    pool->task = NULL;
+    pool->arg = NULL;
+    pool->tasks = 0;
+    pool->next = 0;
+    pool->active = 0;
+    pool->generation = 0;
+    pool->stop = false;
+    pool->workers = 0;
+    pool->threads = NULL;
+    if (threads == 1)
+        return true;
+    pool->threads = (pthread_t *)malloc((threads - 1) * sizeof(pthread_t));
+    if (pool->threads == NULL)
+    {
+        fprintf(stderr, "Memory allocation failed for thread pool.\n");
+        return false;
+    }
+    for (size_t i = 0; i + 1 < threads; ++i)
+    {
+        if (pthread_create(&pool->threads[pool->workers], NULL, thread_pool_main, pool) != 0)
+            break;
+        pool->workers++;
+    }
+    return true;
+}
+
+/**
+ * @brief 线程池的并行度（工作线程数加上调用者自身）。
+ */
+size_t ThreadPoolSize(ThreadPool *pool)
+{
+    return pool->workers + 1;
+}
+
+/**
+ * @brief 并行执行task(arg, 0) ~ task(arg, tasks-1)，全部完成后返回。
+ *
+ * @param pool 指向线程池的指针。
+ * @param tasks 任务个数。
+ * @param task 任务函数，不同下标可能在不同线程上同时执行。
+ * @param arg 传给任务函数的参数。
+ * @note 调用者也参与执行任务；返回时所有任务对内存的修改对调用者可见。
+ *       没有工作线程、只有一个任务或在本线程池的任务中嵌套调用时，直接在当前线程上按下标顺序执行。
+ */
+void ThreadPoolRun(ThreadPool *pool, size_t tasks, ThreadPoolTask task, void *arg)
+{
+    if (tasks == 0)
+        return;
+    if (pool->workers == 0 || tasks == 1 || thread_pool_current == pool)
+    {
+        for (size_t i = 0; i < tasks; ++i)
+            task(arg, i);
+        return;
+    }
+    pthread_mutex_lock(&pool->runLock);
+    ThreadPool *outer = thread_pool_current;
+    thread_pool_current = pool;
+
+    pthread_mutex_lock(&pool->lock);
+    while (pool->active > 0) // 上一批中醒得晚的工作线程可能还没离开
+        pthread_cond_wait(&pool->idle, &pool->lock);
+    pool->task = task;
+    pool->arg = arg;
+    pool->tasks = tasks;
+    __atomic_store_n(&pool->next, 0, __ATOMIC_RELAXED);
+    pool->generation++;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+
+    thread_pool_work(pool, task, arg, tasks);
+
+    // 下标已经领完，等仍在执行的工作线程做完手头的任务
+    pthread_mutex_lock(&pool->lock);
+    while (pool->active > 0)
+        pthread_cond_wait(&pool->idle, &pool->lock);
+    pthread_mutex_unlock(&pool->lock);
+
+    thread_pool_current = outer;
+    pthread_mutex_unlock(&pool->runLock);
+}
+
+static ThreadPool thread_pool_default;
+static pthread_once_t thread_pool_default_once = PTHREAD_ONCE_INIT;
+
+static void thread_pool_default_init(void)
+{
+    ThreadPoolCreate(&thread_pool_default, 0);
+}
+
+/**
+ * @brief 进程内共享的线程池，第一次调用时按在线的CPU核数创建，之后一直复用，不需要也不能调用ThreadPoolDelete。
+ */
+ThreadPool *ThreadPoolDefault(void)
+{
+    pthread_once(&thread_pool_default_once, thread_pool_default_init);
+    return &thread_pool_default;
+}
+
+/**
+ * @brief 停止并回收全部工作线程，释放线程池的资源。
+ *
+ * @param pool 指向线程池的指针，调用时不能有正在执行的ThreadPoolRun。
+ */
+void ThreadPoolDelete(ThreadPool *pool)
+{
+    pthread_mutex_lock(&pool->lock);
+    pool->stop = true;
+    pthread_cond_broadcast(&pool->wake);
+    pthread_mutex_unlock(&pool->lock);
+    for (size_t i = 0; i < pool->workers; ++i)
+        pthread_join(pool->threads[i], NULL);
+    free(pool->threads);
+    pool->threads = NULL;
+    pool->workers = 0;
+    pthread_cond_destroy(&pool->idle);
+    pthread_cond_destroy(&pool->wake);
+    pthread_mutex_destroy(&pool->lock);
+    pthread_mutex_destroy(&pool->runLock);
+}
\ No newline at end of file
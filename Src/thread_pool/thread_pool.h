@@ -0,0 +1,47 @@
+#ifndef __THREAD_POOL_H__
+#define __THREAD_POOL_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <pthread.h>
+
+/// 任务函数：index为任务下标，取值0 ~ tasks-1
+typedef void (*ThreadPoolTask)(void *arg, size_t index);
+
+/**
+ * @brief 常驻的fork-join线程池：工作线程创建一次后一直睡眠等待，ThreadPoolRun发布一批任务并唤醒它们，
+ *        调用者自己也参与执行，全部任务完成后才返回。
+ *
+ * 任务按下标从一个原子计数器中领取，先做完的线程自动多领，因此各任务的耗时不必相同。
+ * 不同线程对同一个线程池调用ThreadPoolRun会依次执行；在任务中再次调用同一个线程池的ThreadPoolRun时，
+ * 内层任务直接在当前线程上串行执行，不会死锁。
+ */
+typedef struct ThreadPool
+{
+    pthread_t *threads;      ///< 工作线程
+    size_t workers;          ///< 工作线程数，不含调用ThreadPoolRun的线程
+    pthread_mutex_t runLock; ///< 串行化不同线程的ThreadPoolRun
+    pthread_mutex_t lock;    ///< 保护下面的字段
+    pthread_cond_t wake;     ///< 发布新任务或停止时唤醒工作线程
+    pthread_cond_t idle;     ///< 最后一个工作线程离开当前任务时唤醒调用者
+    ThreadPoolTask task;     ///< 当前任务函数
+    void *arg;               ///< 当前任务参数
+    size_t tasks;            ///< 当前任务个数
+    size_t next;             ///< 下一个待领取的任务下标，原子递增
+    size_t active;           ///< 正在参与当前任务的工作线程数
+    uint64_t generation;     ///< 每发布一批任务加一，工作线程据此判断是否有新任务
+    bool stop;               ///< ThreadPoolDelete时置位，工作线程退出
+} ThreadPool;
+
+bool ThreadPoolCreate(ThreadPool *pool, size_t threads);
+
+size_t ThreadPoolSize(ThreadPool *pool);
+
+void ThreadPoolRun(ThreadPool *pool, size_t tasks, ThreadPoolTask task, void *arg);
+
+ThreadPool *ThreadPoolDefault(void);
+
+void ThreadPoolDelete(ThreadPool *pool);
+
+#endif
@@ -3,31 +3,264 @@
  * @brief 此文件包含了对自定义向量（Vector）数据结构进行操作的一系列函数，涵盖创建、调整大小、设置与获取元素值、添加元素、判断状态以及释放内存等功能。
  */
 
+#define _GNU_SOURCE // mremap
 #include "vector.h"
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+
+/// 映射文件头，位于文件开头，占VECTOR_MAPPED_HEADER_SIZE字节
+typedef struct VectorFileHeader
+{
+    uint64_t magic;     // VECTOR_MAPPED_MAGIC
+    uint64_t valueSize; // 元素大小
+    uint64_t len;       // 上一次检查点时的元素个数
+    uint64_t size;      // 容量（元素个数），文件长度为VECTOR_MAPPED_HEADER_SIZE + size * valueSize
+} VectorFileHeader;
+
+/// 映射向量的文件信息
+struct VectorMapping
+{
+    int fd;
+    bool readOnly;
+    char *base;    // 映射的起始地址（文件头），data = base + VECTOR_MAPPED_HEADER_SIZE
+    size_t mapped; // 映射的字节数
+};
 
 /**
  * @brief 创建一个向量（Vector）实例并为其数据存储区域分配内存。
  *
  * @param this 指向要创建的向量结构体的指针，通过该指针在函数内部初始化向量的各个成员变量，如容量（size）、元素大小（valueSize）以及已存储元素个数（len）等，并分配用于存储数据的内存空间。
- * @param size 向量的初始容量大小，即最多能容纳的元素个数，以元素个数为单位进行计量。
+ * @param size 向量的初始容量大小，即最多能容纳的元素个数，以元素个数为单位进行计量。可以为`0`，此时不分配内存，第一次添加元素时再扩容。
  * @param valueSize 每个元素所占用的字节数，用于准确分配内存空间以及后续对元素进行复制等操作，确保内存操作的正确性。
  * @return bool 如果内存分配成功，完成向量的创建及初始化工作，将返回`true`；若内存分配失败，则输出错误提示信息到标准错误输出，并返回`false`。
  */
 bool VectorCreate(Vector *this, size_t size, size_t valueSize)
+{
+    AllocatorOptions options = {0};
+    if (!VectorCreateWithOptions(this, size, valueSize, &options))
+    {
+        return false;
+    }
+    if (this->data != NULL)
+    {
+        memset(this->data, 0, valueSize * size);
+    }
+    return true;
+}
+
+/**
+ * @brief 按指定的分配方式创建一个向量（Vector），之后的扩容、缩容和释放都沿用这组选项。
+ *
+ * @param this 指向要创建的向量结构体的指针。
+ * @param size 向量的初始容量（元素个数），可以为`0`。
+ * @param valueSize 每个元素所占用的字节数。
+ * @param options 分配方式：alignment指定数据起始地址的对齐（如64字节，便于SIMD和避免伪共享）；hugePages使用透明大页或MAP_HUGETLB大页以减少TLB缺失；
+ *                达到mapThreshold字节的存储直接用mmap分配，扩容时用mremap移动页表而不复制数据；zeroFill为`true`时新分配的内存清零。
+ *                与VectorCreate不同，默认不清零，创建时不会访问每一页。
+ * @return bool 如果内存分配成功返回`true`；失败时输出错误提示信息到标准错误输出，并返回`false`。
+ */
+bool VectorCreateWithOptions(Vector *this, size_t size, size_t valueSize, const AllocatorOptions *options)
 {
     this->size = size;
     this->valueSize = valueSize;
-    this->data = malloc(valueSize * size);
-    if (this->data == NULL)
+    this->growFactor = VECTOR_DEFAULT_GROW_FACTOR;
+    this->inlineData = false;
+    this->mapping = NULL;
+    this->alloc = *options;
+    this->len = 0;
+    if (valueSize != 0 && size > SIZE_MAX / valueSize)
     {
         fprintf(stderr, "Memory allocation failed for vector data.\n");
         return false;
     }
-    memset(this->data, 0, valueSize * size);
+    this->data = AllocatorAlloc(&this->alloc, valueSize * size);
+    if (this->data == NULL && valueSize * size > 0)
+    {
+        fprintf(stderr, "Memory allocation failed for vector data.\n");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief 用调用者提供的内联存储创建一个向量（Vector），不分配内存也不清零，元素个数超过内联容量时才搬到堆上。
+ *
+ * @param this 指向要创建的向量结构体的指针。
+ * @param storage 内联存储的起始地址，至少能容纳size个元素，生命周期必须覆盖向量的整个使用期间；通常用VECTOR_INLINE和VECTOR_INLINE_INIT把它和向量放在同一个结构体里。
+ * @param size 内联存储能容纳的元素个数。
+ * @param valueSize 每个元素所占用的字节数。
+ * @return bool 总是返回`true`，与VectorCreate保持一致的调用方式。
+ */
+bool VectorCreateInline(Vector *this, void *storage, size_t size, size_t valueSize)
+{
+    this->size = size;
     this->len = 0;
+    this->valueSize = valueSize;
+    this->data = storage;
+    this->growFactor = VECTOR_DEFAULT_GROW_FACTOR;
+    this->inlineData = true;
+    this->mapping = NULL;
+    memset(&this->alloc, 0, sizeof(this->alloc));
+    return true;
+}
+
+/**
+ * @brief 用一个映射到内存的文件作为向量（Vector）的存储，重启后再次打开即可直接使用其中的元素，不需要重新解析或复制。
+ *
+ * @param this 指向要创建的向量结构体的指针。
+ * @param path 文件路径。文件由一个VECTOR_MAPPED_HEADER_SIZE字节的文件头（魔数、元素大小、元素个数、容量）和紧随其后的元素组成。
+ * @param valueSize 每个元素所占用的字节数，打开已有文件时必须与文件头中记录的一致。
+ * @param mode 打开方式：VECTOR_MAPPED_READ只读共享映射，多个进程打开同一个文件时共用页缓存；VECTOR_MAPPED_WRITE读写，文件不存在时新建；
+ *             VECTOR_MAPPED_CREATE读写并清空已有内容。
+ * @note 之后对向量的所有操作都照常进行，扩容时用`ftruncate`加长文件再用`mremap`扩大映射，元素不需要复制。
+ *       文件头中的元素个数只在VectorMappedSync和VectorDelete时更新；同一时间只能有一个进程以读写方式打开同一个文件。
+ *       VectorDelete会写回文件头、解除映射并关闭文件，不会删除文件。
+ * @return bool 成功返回`true`；文件打不开、不是有效的映射向量文件、元素大小不符或映射失败时输出错误提示信息到标准错误输出，并返回`false`。
+ */
+bool VectorOpenMapped(Vector *this, const char *path, size_t valueSize, VectorMappedMode mode)
+{
+    if (valueSize == 0)
+    {
+        fprintf(stderr, "Error: Value size must not be 0 in VectorOpenMapped.\n");
+        return false;
+    }
+    bool readOnly = mode == VECTOR_MAPPED_READ;
+    int flags = readOnly ? O_RDONLY : O_RDWR | O_CREAT | (mode == VECTOR_MAPPED_CREATE ? O_TRUNC : 0);
+    int fd = open(path, flags, 0644);
+    if (fd < 0)
+    {
+        fprintf(stderr, "Vector failed to open %s.\n", path);
+        return false;
+    }
+    struct stat st;
+    VectorFileHeader header;
+    bool ok = fstat(fd, &st) == 0;
+    if (ok && st.st_size == 0 && !readOnly)
+    {
+        // 新文件：写入一个空向量的文件头
+        memset(&header, 0, sizeof(header));
+        header.magic = VECTOR_MAPPED_MAGIC;
+        header.valueSize = valueSize;
+        ok = ftruncate(fd, VECTOR_MAPPED_HEADER_SIZE) == 0 &&
+             pwrite(fd, &header, sizeof(header), 0) == (ssize_t)sizeof(header);
+    }
+    else if (ok)
+    {
+        ok = (size_t)st.st_size >= VECTOR_MAPPED_HEADER_SIZE &&
+             pread(fd, &header, sizeof(header), 0) == (ssize_t)sizeof(header) &&
+             header.magic == VECTOR_MAPPED_MAGIC && header.valueSize == valueSize && header.len <= header.size &&
+             header.size <= ((size_t)st.st_size - VECTOR_MAPPED_HEADER_SIZE) / valueSize;
+    }
+    if (!ok)
+    {
+        fprintf(stderr, "Vector file %s is not a mapped vector with value size %zu.\n", path, valueSize);
+        close(fd);
+        return false;
+    }
+    size_t mapped = VECTOR_MAPPED_HEADER_SIZE + header.size * valueSize;
+    char *base = (char *)mmap(NULL, mapped, readOnly ? PROT_READ : PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    struct VectorMapping *mapping = base == MAP_FAILED ? NULL : (struct VectorMapping *)malloc(sizeof(struct VectorMapping));
+    if (mapping == NULL)
+    {
+        fprintf(stderr, "Vector failed to map %s.\n", path);
+        if (base != MAP_FAILED)
+            munmap(base, mapped);
+        close(fd);
+        return false;
+    }
+    mapping->fd = fd;
+    mapping->readOnly = readOnly;
+    mapping->base = base;
+    mapping->mapped = mapped;
+    this->size = header.size;
+    this->len = header.len;
+    this->valueSize = valueSize;
+    this->data = base + VECTOR_MAPPED_HEADER_SIZE;
+    this->growFactor = VECTOR_DEFAULT_GROW_FACTOR;
+    this->inlineData = false;
+    this->mapping = mapping;
+    memset(&this->alloc, 0, sizeof(this->alloc));
+    return true;
+}
+
+/**
+ * @brief 为映射文件中的向量做一次检查点：把当前的元素个数写进文件头，并把修改过的页写回文件。
+ *
+ * @param this 指向由VectorOpenMapped打开的向量结构体的指针。
+ * @param wait 为`true`时同步写回：先等元素落盘，再更新文件头并等文件头落盘，因此崩溃后重新打开看到的元素个数不会超过已经落盘的元素；
+ *             为`false`时只更新文件头并发起异步写回（`MS_ASYNC`），立即返回。
+ * @return bool 成功返回`true`（只读映射什么也不做）；向量不是映射向量或`msync`失败时输出错误提示信息到标准错误输出，并返回`false`。
+ */
+bool VectorMappedSync(Vector *this, bool wait)
+{
+    struct VectorMapping *mapping = this->mapping;
+    if (mapping == NULL)
+    {
+        fprintf(stderr, "Error: VectorMappedSync on a vector that is not mapped.\n");
+        return false;
+    }
+    if (mapping->readOnly)
+    {
+        return true;
+    }
+    VectorFileHeader *header = (VectorFileHeader *)mapping->base;
+    if (wait && msync(mapping->base, mapping->mapped, MS_SYNC) != 0)
+    {
+        fprintf(stderr, "Vector failed to sync mapped data.\n");
+        return false;
+    }
+    header->len = this->len < this->size ? this->len : this->size;
+    header->size = this->size;
+    if (msync(mapping->base, wait ? VECTOR_MAPPED_HEADER_SIZE : mapping->mapped, wait ? MS_SYNC : MS_ASYNC) != 0)
+    {
+        fprintf(stderr, "Vector failed to sync mapped data.\n");
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief 调整映射向量的容量：先改文件长度，再用`mremap`改变映射大小（必要时移动映射地址），元素不需要复制。
+ */
+static bool vector_mapped_resize(Vector *this, size_t newSize)
+{
+    struct VectorMapping *mapping = this->mapping;
+    if (mapping->readOnly)
+    {
+        fprintf(stderr, "Error: Cannot resize a read-only mapped vector.\n");
+        return false;
+    }
+    if (newSize > (SIZE_MAX - VECTOR_MAPPED_HEADER_SIZE) / this->valueSize)
+    {
+        fprintf(stderr, "Memory reallocation failed.\n");
+        return false;
+    }
+    size_t bytes = VECTOR_MAPPED_HEADER_SIZE + newSize * this->valueSize;
+    if (bytes > mapping->mapped && ftruncate(mapping->fd, bytes) != 0)
+    {
+        fprintf(stderr, "Vector failed to extend mapped file.\n");
+        return false;
+    }
+    void *base = mremap(mapping->base, mapping->mapped, bytes, MREMAP_MAYMOVE);
+    if (base == MAP_FAILED)
+    {
+        fprintf(stderr, "Memory reallocation failed.\n");
+        if (bytes > mapping->mapped)
+            ftruncate(mapping->fd, mapping->mapped);
+        return false;
+    }
+    if (bytes < mapping->mapped)
+        ftruncate(mapping->fd, bytes);
+    mapping->base = (char *)base;
+    mapping->mapped = bytes;
+    ((VectorFileHeader *)mapping->base)->size = newSize;
+    this->data = mapping->base + VECTOR_MAPPED_HEADER_SIZE;
+    this->size = newSize;
     return true;
 }
 
@@ -36,11 +269,46 @@ bool VectorCreate(Vector *this, size_t size, size_t valueSize)
  *
  * @param this 指向要调整大小的向量结构体的指针，通过该指针获取当前向量的相关信息（如原数据指针、元素大小等），并在内存重新分配成功后更新向量的容量（size）等成员变量。
  * @param newSize 新的向量大小，即调整后向量最多能容纳的元素个数，新大小可以大于或小于当前的容量大小，用于按需改变向量的存储能力。
- * @return bool 如果内存重新分配（`realloc`操作）成功，更新向量的相关成员变量并返回`true`；若内存重新分配失败，则输出错误提示信息到标准错误输出，并返回`false`。
+ * @return bool 如果内存重新分配（`realloc`操作，按创建时的分配方式可能是`mremap`）成功，更新向量的相关成员变量并返回`true`；若内存重新分配失败，则输出错误提示信息到标准错误输出，并返回`false`。新容量为`0`时释放数据内存。使用内联存储的向量会被搬到新分配的堆内存上；映射向量改变文件长度和映射大小，只读映射不能调整。
  */
 bool VectorResize(Vector *this, size_t newSize)
 {
-    void *newData = realloc(this->data, newSize * this->valueSize);
+    if (this->valueSize != 0 && newSize > SIZE_MAX / this->valueSize)
+    {
+        fprintf(stderr, "Memory reallocation failed.\n");
+        return false;
+    }
+    if (this->mapping != NULL)
+    {
+        return vector_mapped_resize(this, newSize);
+    }
+    if (this->inlineData)
+    {
+        // 内联存储不能realloc：搬到新分配的堆内存上，之后就和普通向量一样
+        void *heapData = AllocatorAlloc(&this->alloc, newSize * this->valueSize);
+        if (heapData == NULL && newSize > 0)
+        {
+            fprintf(stderr, "Memory reallocation failed.\n");
+            return false;
+        }
+        if (heapData != NULL)
+        {
+            memcpy(heapData, this->data, (this->len < newSize ? this->len : newSize) * this->valueSize);
+        }
+        this->data = heapData;
+        this->size = newSize;
+        this->inlineData = false;
+        return true;
+    }
+    size_t oldBytes = this->size * this->valueSize, newBytes = newSize * this->valueSize;
+    if (newBytes == 0)
+    {
+        AllocatorFree(&this->alloc, this->data, oldBytes);
+        this->data = NULL;
+        this->size = newSize;
+        return true;
+    }
+    void *newData = AllocatorRealloc(&this->alloc, this->data, oldBytes, newBytes);
     if (newData == NULL)
     {
         fprintf(stderr, "Memory reallocation failed.\n");
@@ -61,12 +329,12 @@ bool VectorResize(Vector *this, size_t newSize)
  */
 bool VectorSetValue(Vector *this, size_t index, void *value)
 {
-    if (index > this->size)
+    if (index >= this->size)
     {
         fprintf(stderr, "Error: Index out of bounds in VectorSetValue.\n");
         return false;
     }
-    if (index > this->len - 1)
+    if (index >= this->len)
     {
         this->len = index + 1;
     }
@@ -83,7 +351,7 @@ bool VectorSetValue(Vector *this, size_t index, void *value)
  */
 void *VectorGetValue(Vector *this, size_t index)
 {
-    if (index > this->len - 1 || this->data == NULL)
+    if (index >= this->len || this->data == NULL)
     {
         fprintf(stderr, "Error: Index out of bounds in VectorGetValue.\n");
         return NULL;
@@ -92,7 +360,34 @@ void *VectorGetValue(Vector *this, size_t index)
 }
 
 /**
- * @brief 在向量（Vector）的末尾添加一个元素值，若向量已满，会自动进行扩容操作（扩大为当前容量的两倍）后再添加元素。
+ * @brief 保证向量（Vector）的容量至少为minSize，不够时按扩容倍数一次扩到位。
+ *
+ * @param this 指向目标向量结构体的指针。
+ * @param minSize 需要的最小容量（元素个数）。
+ * @return bool 容量已经足够或扩容成功返回`true`；扩容失败返回`false`，向量保持不变。
+ */
+static bool vector_grow(Vector *this, size_t minSize)
+{
+    if (minSize <= this->size)
+    {
+        return true;
+    }
+    double factor = this->growFactor > 1.0 ? this->growFactor : VECTOR_DEFAULT_GROW_FACTOR;
+    double scaled = (double)this->size * factor;
+    size_t newSize = scaled < (double)SIZE_MAX ? (size_t)scaled : SIZE_MAX;
+    if (newSize < VECTOR_MIN_GROW_SIZE)
+    {
+        newSize = VECTOR_MIN_GROW_SIZE;
+    }
+    if (newSize < minSize)
+    {
+        newSize = minSize;
+    }
+    return VectorResize(this, newSize);
+}
+
+/**
+ * @brief 在向量（Vector）的末尾添加一个元素值，若向量已满，会自动进行扩容操作（按扩容倍数growFactor扩大，容量为`0`时扩到VECTOR_MIN_GROW_SIZE）后再添加元素。
  *
  * @param this 指向目标向量结构体的指针，将元素添加到该向量的末尾位置。
  * @param value 指向要添加的元素值所在内存位置的指针，函数会根据元素大小（valueSize）将该值复制到向量末尾的内存位置。
@@ -103,8 +398,7 @@ bool VectorPushBack(Vector *this, void *value)
     if (this->len == this->size)
     {
         // 自动扩容
-        size_t newSize = this->size * 2; // 扩大两倍
-        if (!VectorResize(this, newSize))
+        if (!vector_grow(this, this->len + 1))
         {
             // 如果扩容失败，返回 false
             return false;
@@ -115,6 +409,156 @@ bool VectorPushBack(Vector *this, void *value)
     return true;
 }
 
+/**
+ * @brief 设置向量（Vector）的扩容倍数，之后每次自动扩容时容量变为原来的growFactor倍（且不小于所需的大小）。
+ *
+ * @param this 指向目标向量结构体的指针。
+ * @param growFactor 扩容倍数，必须大于`1`；传入不大于`1`的值时恢复为默认值VECTOR_DEFAULT_GROW_FACTOR。较小的倍数（如`1.5`）更省内存，较大的倍数扩容次数更少。
+ */
+void VectorSetGrowFactor(Vector *this, double growFactor)
+{
+    this->growFactor = growFactor > 1.0 ? growFactor : VECTOR_DEFAULT_GROW_FACTOR;
+}
+
+/**
+ * @brief 预留向量（Vector）的容量，保证之后添加元素直到容量达到size之前都不会再扩容。
+ *
+ * @param this 指向目标向量结构体的指针。
+ * @param size 需要的容量（元素个数），不大于当前容量时什么也不做。
+ * @return bool 容量已经足够或内存重新分配成功返回`true`；分配失败时输出错误提示信息到标准错误输出，并返回`false`。
+ */
+bool VectorReserve(Vector *this, size_t size)
+{
+    if (size <= this->size)
+    {
+        return true;
+    }
+    return VectorResize(this, size);
+}
+
+/**
+ * @brief 把向量（Vector）的容量缩小到恰好等于已存储的元素个数，释放多余的内存。
+ *
+ * @param this 指向目标向量结构体的指针。
+ * @return bool 成功返回`true`；内存重新分配失败时向量保持不变并返回`false`。向量为空时释放全部数据内存，容量变为`0`；映射向量则把文件截短到只剩已有的元素。使用内联存储时什么也不做。
+ */
+bool VectorShrinkToFit(Vector *this)
+{
+    if (this->len == this->size || this->inlineData)
+    {
+        return true;
+    }
+    if (this->len == 0 && this->mapping == NULL)
+    {
+        AllocatorFree(&this->alloc, this->data, this->size * this->valueSize);
+        this->data = NULL;
+        this->size = 0;
+        return true;
+    }
+    return VectorResize(this, this->len);
+}
+
+/**
+ * @brief 在向量（Vector）的末尾一次添加n个元素，最多扩容一次，数据用一次`memcpy`复制。
+ *
+ * @param this 指向目标向量结构体的指针。
+ * @param values 指向连续存放的n个元素，每个元素valueSize字节；不能指向本向量自身的数据（扩容后原地址会失效）。
+ * @param n 要添加的元素个数，为`0`时什么也不做。
+ * @return bool 添加成功返回`true`；扩容失败返回`false`，向量保持不变。
+ */
+bool VectorAppendN(Vector *this, const void *values, size_t n)
+{
+    return VectorInsertRange(this, this->len, values, n);
+}
+
+/**
+ * @brief 在向量（Vector）的index位置插入n个元素，原来从index开始的元素整体后移，最多扩容一次，后移只用一次`memmove`。
+ *
+ * @param this 指向目标向量结构体的指针。
+ * @param index 插入位置，从`0`开始计数，不能超过已存储元素个数（len），等于len时相当于在末尾追加。
+ * @param values 指向连续存放的n个元素；不能指向本向量自身的数据（扩容和后移都会改变它）。
+ * @param n 要插入的元素个数，为`0`时什么也不做。
+ * @return bool 插入成功返回`true`；索引越界时输出错误提示信息到标准错误输出并返回`false`；扩容失败返回`false`，向量保持不变。
+ */
+bool VectorInsertRange(Vector *this, size_t index, const void *values, size_t n)
+{
+    if (index > this->len)
+    {
+        fprintf(stderr, "Error: Index out of bounds in VectorInsertRange.\n");
+        return false;
+    }
+    if (n == 0)
+    {
+        return true;
+    }
+    if (n > SIZE_MAX - this->len || !vector_grow(this, this->len + n))
+    {
+        return false;
+    }
+    char *at = (char *)this->data + index * this->valueSize;
+    if (index < this->len)
+    {
+        memmove(at + n * this->valueSize, at, (this->len - index) * this->valueSize);
+    }
+    memcpy(at, values, n * this->valueSize);
+    this->len += n;
+    return true;
+}
+
+/**
+ * @brief 删除向量（Vector）中从index开始的n个元素，后面的元素整体前移，只用一次`memmove`，容量不变。
+ *
+ * @param this 指向目标向量结构体的指针。
+ * @param index 要删除的第一个元素的索引，从`0`开始计数。
+ * @param n 要删除的元素个数，index + n不能超过已存储元素个数（len）。
+ * @return bool 删除成功返回`true`；范围越界时输出错误提示信息到标准错误输出并返回`false`。
+ */
+bool VectorEraseRange(Vector *this, size_t index, size_t n)
+{
+    if (index > this->len || n > this->len - index)
+    {
+        fprintf(stderr, "Error: Range out of bounds in VectorEraseRange.\n");
+        return false;
+    }
+    if (n == 0)
+    {
+        return true;
+    }
+    char *at = (char *)this->data + index * this->valueSize;
+    memmove(at, at + n * this->valueSize, (this->len - index - n) * this->valueSize);
+    this->len -= n;
+    return true;
+}
+
+/**
+ * @brief 把另一个向量（Vector）的全部元素追加到本向量末尾，最多扩容一次。
+ *
+ * @param this 指向目标向量结构体的指针。
+ * @param other 指向被追加的向量，元素大小（valueSize）必须与本向量相同；可以就是本向量（把自身复制一遍追加到末尾）。
+ * @return bool 追加成功返回`true`；元素大小不同时输出错误提示信息到标准错误输出并返回`false`；扩容失败返回`false`，向量保持不变。
+ */
+bool VectorAppendVector(Vector *this, const Vector *other)
+{
+    if (other->valueSize != this->valueSize)
+    {
+        fprintf(stderr, "Error: Value size mismatch in VectorAppendVector.\n");
+        return false;
+    }
+    size_t n = other->len;
+    if (n == 0)
+    {
+        return true;
+    }
+    if (n > SIZE_MAX - this->len || !vector_grow(this, this->len + n))
+    {
+        return false;
+    }
+    // 扩容之后再取other->data，this == other时拿到的是新地址
+    memcpy((char *)this->data + this->len * this->valueSize, other->data, n * this->valueSize);
+    this->len += n;
+    return true;
+}
+
 /**
  * @brief 删除向量（Vector）并释放为其数据存储区域分配的内存，同时将向量结构体的相关成员变量重置为初始值，以完成资源的回收和清理工作。
  *
@@ -122,9 +566,31 @@ bool VectorPushBack(Vector *this, void *value)
  */
 void VectorDelete(Vector *this)
 {
+    if (this->mapping != NULL)
+    {
+        // 映射向量：写回文件头中的元素个数，解除映射并关闭文件，脏页由内核写回
+        struct VectorMapping *mapping = this->mapping;
+        if (!mapping->readOnly)
+        {
+            ((VectorFileHeader *)mapping->base)->len = this->len < this->size ? this->len : this->size;
+        }
+        munmap(mapping->base, mapping->mapped);
+        close(mapping->fd);
+        free(mapping);
+        this->mapping = NULL;
+        this->data = NULL;
+        this->size = 0;
+        this->len = 0;
+        this->valueSize = 0;
+        return;
+    }
     if (this->data != NULL)
     {
-        free(this->data);
+        if (!this->inlineData)
+        {
+            AllocatorFree(&this->alloc, this->data, this->size * this->valueSize);
+        }
+        this->inlineData = false;
         this->data = NULL;
         this->size = 0;
         this->len = 0;
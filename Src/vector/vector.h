@@ -4,15 +4,56 @@
 
 #include <stdbool.h>
 #include <stdint.h>
+#include <stddef.h>
+
+#include "../allocator/allocator.h"
+
+#define VECTOR_DEFAULT_GROW_FACTOR 2.0 // 默认扩容倍数
+#define VECTOR_MIN_GROW_SIZE 4         // 从空向量扩容时的最小容量
+
+#define VECTOR_MAPPED_MAGIC 0x3143455652415453ULL // 映射文件的魔数，按小端存储即"STARVEC1"
+#define VECTOR_MAPPED_HEADER_SIZE 64              // 映射文件头的字节数，元素从这个偏移开始存放
+
+/// VectorOpenMapped打开文件的方式
+typedef enum VectorMappedMode
+{
+    VECTOR_MAPPED_READ,   // 只读打开已有文件，多个进程可以共享同一份页缓存；不能修改元素，也不能扩容
+    VECTOR_MAPPED_WRITE,  // 读写打开，文件不存在或为空时新建一个空向量
+    VECTOR_MAPPED_CREATE  // 读写打开，清空已有内容
+} VectorMappedMode;
 
 typedef struct Vector
 {
     size_t size, len, valueSize;
     void *data;
+    double growFactor;
+    bool inlineData;                // data指向调用者提供的内联存储（VectorCreateInline），不能free
+    struct VectorMapping *mapping;  // data位于映射文件中（VectorOpenMapped），普通向量为NULL
+    AllocatorOptions alloc;         // 堆上存储的分配方式（对齐、大页、mmap阈值、是否清零）
 } Vector;
 
+/// 带N个元素内联存储的向量：前N个元素存放在结构体内部，超出时才搬到堆上。
+/// 用VECTOR_INLINE_INIT初始化，之后对.vec调用任何Vector函数；data指向结构体自身，初始化后不能再按值复制或移动它。
+#define VECTOR_INLINE(T, N) \
+    struct                  \
+    {                       \
+        Vector vec;         \
+        T storage[N];       \
+    }
+
+#define VECTOR_INLINE_INIT(v) \
+    VectorCreateInline(&(v)->vec, (v)->storage, sizeof((v)->storage) / sizeof((v)->storage[0]), sizeof((v)->storage[0]))
+
 bool VectorCreate(Vector *this, size_t size, size_t valueSize);
 
+bool VectorCreateWithOptions(Vector *this, size_t size, size_t valueSize, const AllocatorOptions *options);
+
+bool VectorCreateInline(Vector *this, void *storage, size_t size, size_t valueSize);
+
+bool VectorOpenMapped(Vector *this, const char *path, size_t valueSize, VectorMappedMode mode);
+
+bool VectorMappedSync(Vector *this, bool wait);
+
 bool VectorResize(Vector *this, size_t newSize);
 
 bool VectorSetValue(Vector *this, size_t index, void *value);
@@ -21,6 +62,20 @@ void *VectorGetValue(Vector *this, size_t index);
 
 bool VectorPushBack(Vector *this, void *value);
 
+void VectorSetGrowFactor(Vector *this, double growFactor);
+
+bool VectorReserve(Vector *this, size_t size);
+
+bool VectorShrinkToFit(Vector *this);
+
+bool VectorAppendN(Vector *this, const void *values, size_t n);
+
+bool VectorInsertRange(Vector *this, size_t index, const void *values, size_t n);
+
+bool VectorEraseRange(Vector *this, size_t index, size_t n);
+
+bool VectorAppendVector(Vector *this, const Vector *other);
+
 void VectorDelete(Vector *this);
 
 bool VectorIsFull(Vector *this);
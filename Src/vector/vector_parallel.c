@@ -0,0 +1,425 @@
+/**
+ * @file vector_parallel.h 相关函数实现
+ * @brief 此文件包含了在共享线程池（ThreadPoolDefault）上并行执行的向量（Vector）算法：遍历、变换、归约和排序。
+ *        数据按元素下标切成若干连续的块，块的大小按线程数和VECTOR_PARALLEL_MIN_BYTES自动确定。
+ */
+
+#include "vector_parallel.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// 一次并行操作的参数，每个任务处理[index * grain, (index + 1) * grain)范围内的元素
+typedef struct VectorParallelJob
+{
+    char *src;           ///< 输入元素
+    char *dst;           ///< 输出元素（变换、排序）
+    size_t n;            ///< 元素个数
+    size_t valueSize;    ///< 输入元素大小
+    size_t dstSize;      ///< 输出元素大小
+    size_t grain;        ///< 每块的元素个数
+    void *ctx;           ///< 用户参数
+    VectorForEachFn forEach;
+    VectorTransformFn transform;
+    VectorReduceFn reduce;
+    char *partials;      ///< 归约时各块的部分结果，按缓存行对齐
+    size_t resultSize;   ///< 归约结果的大小
+    size_t stride;       ///< 相邻两块部分结果的间隔，为缓存行大小的整数倍
+    VectorElemType type; ///< 基数排序的元素类型
+    bool back;           ///< 基数排序：键变换的方向
+    size_t bytes;        ///< 基数排序：键的字节数
+    size_t digit;        ///< 基数排序：当前处理的字节
+    size_t *hist;        ///< 基数排序：各块各字节的直方图，下标为(块 * bytes + 字节) * 256 + 取值
+    VectorCompareFn cmp; ///< 归并排序的比较函数
+    size_t width;        ///< 归并排序：本轮每段有序区间的长度
+    bool failed;         ///< 有任务失败（内存分配）时置位
+} VectorParallelJob;
+
+/// @brief 按线程数自动确定块的大小：每个线程约VECTOR_PARALLEL_CHUNKS_PER_THREAD块，但每块不少于VECTOR_PARALLEL_MIN_BYTES字节
+/// @return 块数；每块的元素个数写入job->grain
+static size_t vector_parallel_split(VectorParallelJob *job, size_t perThread)
+{
+    size_t minGrain = VECTOR_PARALLEL_MIN_BYTES / job->valueSize;
+    if (minGrain == 0)
+        minGrain = 1;
+    size_t chunks = ThreadPoolSize(ThreadPoolDefault()) * perThread;
+    if (chunks > (job->n + minGrain - 1) / minGrain)
+        chunks = (job->n + minGrain - 1) / minGrain;
+    if (chunks == 0)
+        chunks = 1;
+    job->grain = (job->n + chunks - 1) / chunks;
+    return (job->n + job->grain - 1) / job->grain;
+}
+
+/// @brief 第index块的元素下标范围[*lo, *hi)
+static void vector_parallel_range(const VectorParallelJob *job, size_t index, size_t *lo, size_t *hi)
+{
+    *lo = index * job->grain;
+    *hi = *lo + job->grain < job->n ? *lo + job->grain : job->n;
+}
+
+static void vector_parallel_for_each_task(void *arg, size_t index)
+{
+    VectorParallelJob *job = (VectorParallelJob *)arg;
+    size_t lo, hi;
+    vector_parallel_range(job, index, &lo, &hi);
+    for (size_t i = lo; i < hi; ++i)
+        job->forEach(job->src + i * job->valueSize, i, job->ctx);
+}
+
+/**
+ * @brief 对向量的每个元素并行执行fn。
+ *
+ * @param this 指向向量结构体的指针。
+ * @param fn 对每个元素执行的操作，会在多个线程上同时调用，只能修改自己的元素。
+ * @param ctx 传给fn的参数。
+ * @return bool 总是返回`true`。
+ */
+bool VectorParallelForEach(Vector *this, VectorForEachFn fn, void *ctx)
+{
+    VectorParallelJob job = {.src = (char *)this->data, .n = this->len, .valueSize = this->valueSize, .forEach = fn, .ctx = ctx};
+    if (job.n == 0)
+        return true;
+    size_t chunks = vector_parallel_split(&job, VECTOR_PARALLEL_CHUNKS_PER_THREAD);
+    ThreadPoolRun(ThreadPoolDefault(), chunks, vector_parallel_for_each_task, &job);
+    return true;
+}
+
+static void vector_parallel_transform_task(void *arg, size_t index)
+{
+    VectorParallelJob *job = (VectorParallelJob *)arg;
+    size_t lo, hi;
+    vector_parallel_range(job, index, &lo, &hi);
+    for (size_t i = lo; i < hi; ++i)
+        job->transform(job->src + i * job->valueSize, job->dst + i * job->dstSize, job->ctx);
+}
+
+/**
+ * @brief 并行地由src的每个元素计算dst中对应位置的元素。
+ *
+ * @param src 输入向量。
+ * @param dst 输出向量，必须已经创建，元素大小可以与src不同；容量不足时自动扩容，完成后len等于src的len。
+ *            dst可以就是src（元素大小相同时原地变换）。
+ * @param fn 变换函数，会在多个线程上同时调用。
+ * @param ctx 传给fn的参数。
+ * @return bool 成功返回`true`；dst扩容失败时返回`false`，此时dst的内容不变。
+ */
+bool VectorParallelTransform(const Vector *src, Vector *dst, VectorTransformFn fn, void *ctx)
+{
+    size_t n = src->len;
+    if (dst != src && !VectorReserve(dst, n))
+        return false;
+    VectorParallelJob job = {.src = (char *)src->data, .dst = (char *)dst->data, .n = n, .valueSize = src->valueSize,
+                             .dstSize = dst->valueSize, .transform = fn, .ctx = ctx};
+    if (n > 0)
+    {
+        size_t chunks = vector_parallel_split(&job, VECTOR_PARALLEL_CHUNKS_PER_THREAD);
+        ThreadPoolRun(ThreadPoolDefault(), chunks, vector_parallel_transform_task, &job);
+    }
+    dst->len = n;
+    return true;
+}
+
+static void vector_parallel_reduce_task(void *arg, size_t index)
+{
+    VectorParallelJob *job = (VectorParallelJob *)arg;
+    size_t lo, hi;
+    vector_parallel_range(job, index, &lo, &hi);
+    void *acc = job->partials + index * job->stride;
+    for (size_t i = lo; i < hi; ++i)
+        job->reduce(acc, job->src + i * job->valueSize, job->ctx);
+}
+
+/**
+ * @brief 并行归约：各块从初始值开始用reduce累积出部分结果，再按块的顺序用combine合并进result。
+ *
+ * @param this 输入向量。
+ * @param result 调用时存放归约的初始值（单位元，会被每块各复制一份），返回时存放结果。
+ * @param resultSize 结果的字节数。
+ * @param reduce 把一个元素累积进部分结果，会在多个线程上同时调用（各自操作自己的部分结果）。
+ * @param combine 把一块的部分结果合并进result，只在调用线程上按块的顺序调用。
+ * @param ctx 传给reduce和combine的参数。
+ * @note 运算需要满足结合律；不满足交换律也可以，因为块的合并顺序与元素顺序一致。
+ * @return bool 成功返回`true`；部分结果的内存分配失败时返回`false`，此时result不变。
+ */
+bool VectorParallelReduce(const Vector *this, void *result, size_t resultSize, VectorReduceFn reduce, VectorCombineFn combine, void *ctx)
+{
+    VectorParallelJob job = {.src = (char *)this->data, .n = this->len, .valueSize = this->valueSize,
+                             .reduce = reduce, .resultSize = resultSize, .ctx = ctx};
+    if (job.n == 0)
+        return true;
+    size_t chunks = vector_parallel_split(&job, VECTOR_PARALLEL_CHUNKS_PER_THREAD);
+    // reduce经函数指针调用，每个元素都会写一次部分结果；各块的部分结果独占缓存行，线程之间才不会互相使对方的缓存失效
+    const AllocatorOptions lines = {.alignment = VECTOR_PARALLEL_CACHE_LINE};
+    size_t linesPerChunk = resultSize == 0 ? 1 : (resultSize + VECTOR_PARALLEL_CACHE_LINE - 1) / VECTOR_PARALLEL_CACHE_LINE;
+    job.stride = linesPerChunk * VECTOR_PARALLEL_CACHE_LINE;
+    job.partials = (char *)AllocatorAlloc(&lines, chunks * job.stride);
+    if (job.partials == NULL)
+    {
+        fprintf(stderr, "Memory allocation failed for vector reduce partials.\n");
+        return false;
+    }
+    for (size_t i = 0; i < chunks; ++i)
+        memcpy(job.partials + i * job.stride, result, resultSize);
+    ThreadPoolRun(ThreadPoolDefault(), chunks, vector_parallel_reduce_task, &job);
+    for (size_t i = 0; i < chunks; ++i)
+        combine(result, job.partials + i * job.stride, ctx);
+    AllocatorFree(&lines, job.partials, chunks * job.stride);
+    return true;
+}
+
+/// @brief 并行基数排序支持的键宽度：32/64位元素返回字节数，其余返回0
+static size_t vector_radix_bytes(VectorElemType type)
+{
+    switch (type)
+    {
+    case VECTOR_I32:
+    case VECTOR_U32:
+    case VECTOR_F32:
+        return 4;
+    case VECTOR_I64:
+    case VECTOR_U64:
+    case VECTOR_F64:
+        return 8;
+    default:
+        return 0;
+    }
+}
+
+/// @brief 第i个元素的键（已变换为有序键）在第digit个字节上的取值
+static inline size_t vector_radix_digit(const char *data, size_t i, size_t bytes, size_t digit)
+{
+    uint64_t key = bytes == 4 ? ((const uint32_t *)data)[i] : ((const uint64_t *)data)[i];
+    return (key >> (digit * 8)) & 0xFF;
+}
+
+static void vector_radix_order_task(void *arg, size_t index)
+{
+    VectorParallelJob *job = (VectorParallelJob *)arg;
+    size_t lo, hi;
+    vector_parallel_range(job, index, &lo, &hi);
+    VectorOrderKeys(job->src + lo * job->valueSize, hi - lo, job->type, job->back);
+}
+
+/// @brief 一次读取统计本块所有字节的直方图
+static void vector_radix_hist_all_task(void *arg, size_t index)
+{
+    VectorParallelJob *job = (VectorParallelJob *)arg;
+    size_t lo, hi;
+    vector_parallel_range(job, index, &lo, &hi);
+    size_t *hist = job->hist + index * job->bytes * 256;
+    for (size_t i = lo; i < hi; ++i)
+        for (size_t d = 0; d < job->bytes; ++d)
+            hist[d * 256 + vector_radix_digit(job->src, i, job->bytes, d)]++;
+}
+
+/// @brief 元素搬动过之后，重新统计本块当前字节的直方图
+static void vector_radix_hist_task(void *arg, size_t index)
+{
+    VectorParallelJob *job = (VectorParallelJob *)arg;
+    size_t lo, hi;
+    vector_parallel_range(job, index, &lo, &hi);
+    size_t *hist = job->hist + (index * job->bytes + job->digit) * 256;
+    memset(hist, 0, 256 * sizeof(size_t));
+    for (size_t i = lo; i < hi; ++i)
+        hist[vector_radix_digit(job->src, i, job->bytes, job->digit)]++;
+}
+
+/// @brief 按前缀和给出的位置把本块的元素分散到dst，块内保持原有顺序，因此整体是稳定的
+static void vector_radix_scatter_task(void *arg, size_t index)
+{
+    VectorParallelJob *job = (VectorParallelJob *)arg;
+    size_t lo, hi;
+    vector_parallel_range(job, index, &lo, &hi);
+    size_t *offset = job->hist + (index * job->bytes + job->digit) * 256;
+    if (job->bytes == 4)
+    {
+        const uint32_t *src = (const uint32_t *)job->src;
+        uint32_t *dst = (uint32_t *)job->dst;
+        for (size_t i = lo; i < hi; ++i)
+            dst[offset[(src[i] >> (job->digit * 8)) & 0xFF]++] = src[i];
+    }
+    else
+    {
+        const uint64_t *src = (const uint64_t *)job->src;
+        uint64_t *dst = (uint64_t *)job->dst;
+        for (size_t i = lo; i < hi; ++i)
+            dst[offset[(src[i] >> (job->digit * 8)) & 0xFF]++] = src[i];
+    }
+}
+
+static void vector_parallel_copy_task(void *arg, size_t index)
+{
+    VectorParallelJob *job = (VectorParallelJob *)arg;
+    size_t lo, hi;
+    vector_parallel_range(job, index, &lo, &hi);
+    memcpy(job->dst + lo * job->valueSize, job->src + lo * job->valueSize, (hi - lo) * job->valueSize);
+}
+
+/**
+ * @brief 按元素自身的数值对向量并行升序排序，结果与VectorSort相同。
+ *
+ * @param this 指向要排序的向量结构体的指针。
+ * @param type 元素类型，其大小必须等于向量的valueSize。
+ * @note 32/64位元素使用并行LSD基数排序：每个线程负责一块，一次读取统计出所有字节的直方图，跳过所有键都相同的字节；
+ *       每趟按（取值，块）的顺序求前缀和后各块并行分散，只使用一块临时缓冲区。8/16位元素和数据量较小时直接调用VectorSort。
+ * @return bool 成功返回`true`；元素类型与向量不符或内存分配失败时返回`false`，此时向量内容不变。
+ */
+bool VectorParallelSort(Vector *this, VectorElemType type)
+{
+    VectorParallelJob job = {.src = (char *)this->data, .n = this->len, .valueSize = this->valueSize, .type = type};
+    // 8/16位元素、元素类型与向量不符（由VectorSort报错）和数据量较小时都交给VectorSort
+    if (vector_radix_bytes(type) != this->valueSize || job.n < VECTOR_RADIX_MIN)
+        return VectorSort(this, type);
+    size_t chunks = vector_parallel_split(&job, 1);
+    if (chunks == 1)
+        return VectorSort(this, type);
+
+    ThreadPool *pool = ThreadPoolDefault();
+    char *scratch = (char *)malloc(job.n * job.valueSize);
+    job.bytes = job.valueSize;
+    job.hist = (size_t *)calloc(chunks * job.bytes * 256, sizeof(size_t));
+    if (scratch == NULL || job.hist == NULL)
+    {
+        fprintf(stderr, "Memory allocation failed for vector sort buffer.\n");
+        free(scratch);
+        free(job.hist);
+        return false;
+    }
+    job.back = false;
+    ThreadPoolRun(pool, chunks, vector_radix_order_task, &job);
+    ThreadPoolRun(pool, chunks, vector_radix_hist_all_task, &job);
+
+    char *data = job.src;
+    job.dst = scratch;
+    bool first = true;
+    for (size_t d = 0; d < job.bytes; ++d)
+    {
+        job.digit = d;
+        // 所有块在这一字节上的直方图之和；所有键取值相同时跳过这一趟（第一趟之前统计的直方图对任何趟都有效）
+        size_t same = vector_radix_digit(data, 0, job.bytes, d), total = 0;
+        for (size_t c = 0; c < chunks; ++c)
+            total += job.hist[(c * job.bytes + d) * 256 + same];
+        if (total == job.n)
+            continue;
+        if (!first)
+            ThreadPoolRun(pool, chunks, vector_radix_hist_task, &job);
+        size_t sum = 0;
+        for (size_t b = 0; b < 256; ++b)
+        {
+            for (size_t c = 0; c < chunks; ++c)
+            {
+                size_t *count = &job.hist[(c * job.bytes + d) * 256 + b];
+                size_t t = *count;
+                *count = sum;
+                sum += t;
+            }
+        }
+        ThreadPoolRun(pool, chunks, vector_radix_scatter_task, &job);
+        char *t = job.src;
+        job.src = job.dst;
+        job.dst = t;
+        first = false;
+    }
+    if (job.src != data)
+    {
+        job.dst = data;
+        ThreadPoolRun(pool, chunks, vector_parallel_copy_task, &job);
+        job.src = data;
+    }
+    job.back = true;
+    ThreadPoolRun(pool, chunks, vector_radix_order_task, &job);
+    free(job.hist);
+    free(scratch);
+    return true;
+}
+
+/// @brief 用VectorSortCompare对本块排序：把块包装成一个不拥有内存的向量
+static void vector_merge_sort_chunk_task(void *arg, size_t index)
+{
+    VectorParallelJob *job = (VectorParallelJob *)arg;
+    size_t lo, hi;
+    vector_parallel_range(job, index, &lo, &hi);
+    Vector view = {.size = hi - lo, .len = hi - lo, .valueSize = job->valueSize, .data = job->src + lo * job->valueSize,
+                   .growFactor = VECTOR_DEFAULT_GROW_FACTOR, .inlineData = true};
+    if (!VectorSortCompare(&view, job->cmp))
+        __atomic_store_n(&job->failed, true, __ATOMIC_RELAXED);
+}
+
+/// @brief 把src中相邻的两段有序区间[lo, lo + width)和[lo + width, lo + 2 * width)合并到dst的同一位置，相等时左段在前
+static void vector_merge_task(void *arg, size_t index)
+{
+    VectorParallelJob *job = (VectorParallelJob *)arg;
+    size_t size = job->valueSize;
+    size_t lo = index * 2 * job->width;
+    size_t mid = lo + job->width < job->n ? lo + job->width : job->n;
+    size_t hi = mid + job->width < job->n ? mid + job->width : job->n;
+    const char *a = job->src + lo * size, *aEnd = job->src + mid * size;
+    const char *b = aEnd, *bEnd = job->src + hi * size;
+    char *out = job->dst + lo * size;
+    while (a < aEnd && b < bEnd)
+    {
+        if (job->cmp(b, a) < 0)
+        {
+            memcpy(out, b, size);
+            b += size;
+        }
+        else
+        {
+            memcpy(out, a, size);
+            a += size;
+        }
+        out += size;
+    }
+    memcpy(out, a, aEnd - a);
+    memcpy(out + (aEnd - a), b, bEnd - b);
+}
+
+/**
+ * @brief 用比较函数对向量并行升序排序。
+ *
+ * @param this 指向要排序的向量结构体的指针。
+ * @param cmp 比较函数，规则与qsort相同，会在多个线程上同时调用。
+ * @note 每个线程先用VectorSortCompare排好一块，然后逐轮两两归并（每轮的各次归并并行执行），在数据和一块临时缓冲区之间来回搬运。
+ *       最后几轮的归并数少于线程数，因此加速比低于线程数。排序是不稳定的。
+ * @return bool 成功返回`true`；内存分配失败时返回`false`，此时向量的元素顺序可能已经改变，但元素不会丢失。
+ */
+bool VectorParallelSortCompare(Vector *this, VectorCompareFn cmp)
+{
+    VectorParallelJob job = {.src = (char *)this->data, .n = this->len, .valueSize = this->valueSize, .cmp = cmp};
+    if (job.n < 2)
+        return true;
+    size_t chunks = vector_parallel_split(&job, 1);
+    if (chunks == 1)
+        return VectorSortCompare(this, cmp);
+
+    ThreadPool *pool = ThreadPoolDefault();
+    char *scratch = (char *)malloc(job.n * job.valueSize);
+    if (scratch == NULL)
+    {
+        fprintf(stderr, "Memory allocation failed for vector sort buffer.\n");
+        return false;
+    }
+    ThreadPoolRun(pool, chunks, vector_merge_sort_chunk_task, &job);
+    if (job.failed)
+    {
+        free(scratch);
+        return false;
+    }
+    char *data = job.src;
+    job.dst = scratch;
+    for (job.width = job.grain; job.width < job.n; job.width *= 2)
+    {
+        ThreadPoolRun(pool, (job.n + 2 * job.width - 1) / (2 * job.width), vector_merge_task, &job);
+        char *t = job.src;
+        job.src = job.dst;
+        job.dst = t;
+    }
+    if (job.src != data)
+    {
+        job.dst = data;
+        ThreadPoolRun(pool, chunks, vector_parallel_copy_task, &job);
+    }
+    free(scratch);
+    return true;
+}
\ No newline at end of file
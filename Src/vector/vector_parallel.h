@@ -0,0 +1,38 @@
+#ifndef __VECTOR_PARALLEL_H__
+#define __VECTOR_PARALLEL_H__
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "vector.h"
+#include "vector_simd.h"
+#include "vector_sort.h"
+#include "../thread_pool/thread_pool.h"
+
+#define VECTOR_PARALLEL_MIN_BYTES (64 * 1024) // 每个任务至少处理的字节数，数据较少时减少任务数
+#define VECTOR_PARALLEL_CHUNKS_PER_THREAD 4   // 每个线程平均分到的任务数，多切几块让先做完的线程帮忙
+#define VECTOR_PARALLEL_CACHE_LINE 64         // 归约时各块的部分结果按缓存行隔开，避免不同线程写同一缓存行
+
+/// 对元素value（下标为index）执行的操作
+typedef void (*VectorForEachFn)(void *value, size_t index, void *ctx);
+
+/// 由输入元素in计算输出元素out
+typedef void (*VectorTransformFn)(const void *in, void *out, void *ctx);
+
+/// 把元素value累积进acc
+typedef void (*VectorReduceFn)(void *acc, const void *value, void *ctx);
+
+/// 把另一块的部分结果partial合并进acc
+typedef void (*VectorCombineFn)(void *acc, const void *partial, void *ctx);
+
+bool VectorParallelForEach(Vector *this, VectorForEachFn fn, void *ctx);
+
+bool VectorParallelTransform(const Vector *src, Vector *dst, VectorTransformFn fn, void *ctx);
+
+bool VectorParallelReduce(const Vector *this, void *result, size_t resultSize, VectorReduceFn reduce, VectorCombineFn combine, void *ctx);
+
+bool VectorParallelSort(Vector *this, VectorElemType type);
+
+bool VectorParallelSortCompare(Vector *this, VectorCompareFn cmp);
+
+#endif
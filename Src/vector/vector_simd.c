@@ -0,0 +1,613 @@
+/**
+ * @file vector_simd.h 相关函数实现
+ * @brief 此文件包含了对向量（Vector）做整体扫描的一组内核：查找、计数、求最值、求和以及比较，按CPU支持的指令集在运行时选择AVX-512/AVX2/SSE2版本。
+ */
+
+#include "vector_simd.h"
+#include <stdio.h>
+#include <string.h>
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define VECTOR_X86_SIMD // 扫描内核按CPU选择AVX-512/AVX2/SSE2版本
+#include <immintrin.h>
+#endif
+
+static const size_t vector_elem_size[VECTOR_ELEM_TYPE_COUNT] = {1, 1, 2, 2, 4, 4, 8, 8, 4, 8};
+
+typedef size_t (*VectorScanFn)(const void *data, size_t n, const void *value);
+typedef void (*VectorMinMaxFn)(const void *data, size_t n, void *min, void *max);
+typedef void (*VectorSumFn)(const void *data, size_t n, void *sum);
+
+/// 一种指令集下全部元素类型的内核
+typedef struct VectorKernels
+{
+    VectorScanFn find[VECTOR_ELEM_TYPE_COUNT];
+    VectorScanFn count[VECTOR_ELEM_TYPE_COUNT];
+    VectorMinMaxFn minmax[VECTOR_ELEM_TYPE_COUNT];
+    VectorSumFn sum[VECTOR_ELEM_TYPE_COUNT];
+} VectorKernels;
+
+/// 每个元素类型：(元素类型, 枚举值, 名字后缀, 求和结果的类型, 求和时累加的类型)
+/// 整数一律在uint64_t上累加（按模2^64回绕），有符号整数最后才转换为int64_t，避免有符号溢出
+#define VECTOR_FOR_EACH_TYPE(X, ISA, ATTR, V)                      \
+    X(ISA, ATTR, V, int8_t, VECTOR_I8, i8, int64_t, uint64_t)      \
+    X(ISA, ATTR, V, uint8_t, VECTOR_U8, u8, uint64_t, uint64_t)    \
+    X(ISA, ATTR, V, int16_t, VECTOR_I16, i16, int64_t, uint64_t)   \
+    X(ISA, ATTR, V, uint16_t, VECTOR_U16, u16, uint64_t, uint64_t) \
+    X(ISA, ATTR, V, int32_t, VECTOR_I32, i32, int64_t, uint64_t)   \
+    X(ISA, ATTR, V, uint32_t, VECTOR_U32, u32, uint64_t, uint64_t) \
+    X(ISA, ATTR, V, int64_t, VECTOR_I64, i64, int64_t, uint64_t)   \
+    X(ISA, ATTR, V, uint64_t, VECTOR_U64, u64, uint64_t, uint64_t) \
+    X(ISA, ATTR, V, float, VECTOR_F32, f32, double, double)        \
+    X(ISA, ATTR, V, double, VECTOR_F64, f64, double, double)
+
+#ifdef VECTOR_X86_SIMD
+#define VECTOR_SSE2 __attribute__((target("sse2")))
+#define VECTOR_AVX2 __attribute__((target("avx2")))
+#define VECTOR_AVX512 __attribute__((target("avx512f,avx512bw,avx512dq,avx512vl")))
+
+/// 生成一种元素类型在一种指令集下的基本运算。向量一律用整数向量类型V传递，浮点运算在内部转换类型（不产生指令）。
+/// @param SET1 把标量x广播到每个车道
+/// @param EQ a、b逐车道相等比较，相等的车道全为1
+/// @param BITS a、b逐车道相等比较的位掩码：SSE2/AVX2每个字节一位，AVX-512每个车道一位
+/// @param MIN a、b逐车道的较小值
+/// @param MAX a、b逐车道的较大值
+/// @param SUM 把一块元素v累加进acc：整数加宽后累加进64位车道，浮点数累加进double车道
+#define VECTOR_DEFINE_OPS(ISA, ATTR, V, TN, T, SET1, EQ, BITS, MIN, MAX, SUM)         \
+    ATTR static inline V vector_set1_##TN##_##ISA(T x) { return SET1; }               \
+    ATTR static inline V vector_eq_##TN##_##ISA(V a, V b) { return EQ; }              \
+    ATTR static inline uint64_t vector_eqbits_##TN##_##ISA(V a, V b) { return BITS; } \
+    ATTR static inline V vector_min_##TN##_##ISA(V a, V b) { return MIN; }            \
+    ATTR static inline V vector_max_##TN##_##ISA(V a, V b) { return MAX; }            \
+    ATTR static inline V vector_add_##TN##_##ISA(V acc, V v) { return SUM; }
+
+// ---- SSE2：没有的运算（8/32/64位的最值、无符号比较、64位比较）用比较加选择拼出来 ----
+
+VECTOR_SSE2 static inline __m128i vector_load_sse2(const void *p) { return _mm_loadu_si128((const __m128i *)p); }
+VECTOR_SSE2 static inline __m128i vector_zero_sse2(void) { return _mm_setzero_si128(); }
+VECTOR_SSE2 static inline __m128i vector_sub8_sse2(__m128i a, __m128i b) { return _mm_sub_epi8(a, b); }
+VECTOR_SSE2 static inline uint64_t vector_bits_sse2(__m128i m) { return (unsigned)_mm_movemask_epi8(m); }
+
+/// @brief 各字节（无符号）之和
+VECTOR_SSE2 static inline uint64_t vector_sumbytes_sse2(__m128i x)
+{
+    uint64_t lanes[2];
+    _mm_storeu_si128((__m128i *)lanes, _mm_sad_epu8(x, _mm_setzero_si128()));
+    return lanes[0] + lanes[1];
+}
+
+/// @brief 逐位选择：m为1的位取a，否则取b
+VECTOR_SSE2 static inline __m128i vector_select_sse2(__m128i m, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(m, a), _mm_andnot_si128(m, b));
+}
+
+/// @brief 64位有符号比较a > b：高32位相等时由b - a的符号决定，再把每个车道的高32位结果复制到低32位
+VECTOR_SSE2 static inline __m128i vector_gt64_sse2(__m128i a, __m128i b)
+{
+    __m128i r = _mm_or_si128(_mm_and_si128(_mm_cmpeq_epi32(a, b), _mm_sub_epi64(b, a)), _mm_cmpgt_epi32(a, b));
+    return _mm_shuffle_epi32(r, _MM_SHUFFLE(3, 3, 1, 1));
+}
+
+/// @brief 64位相等比较：两个32位半部都相等
+VECTOR_SSE2 static inline __m128i vector_eq64_sse2(__m128i a, __m128i b)
+{
+    __m128i e = _mm_cmpeq_epi32(a, b);
+    return _mm_and_si128(e, _mm_shuffle_epi32(e, _MM_SHUFFLE(2, 3, 0, 1)));
+}
+
+/// @brief 把4个有符号32位整数符号扩展后加进acc的两个64位车道
+VECTOR_SSE2 static inline __m128i vector_widen32_sse2(__m128i acc, __m128i v)
+{
+    __m128i sign = _mm_cmpgt_epi32(_mm_setzero_si128(), v);
+    return _mm_add_epi64(acc, _mm_add_epi64(_mm_unpacklo_epi32(v, sign), _mm_unpackhi_epi32(v, sign)));
+}
+
+#define VECTOR_FLIP16_SSE2(x) _mm_xor_si128(x, _mm_set1_epi16(INT16_MIN)) // 翻转符号位，无符号比较变为有符号比较
+#define VECTOR_FLIP32_SSE2(x) _mm_xor_si128(x, _mm_set1_epi32(INT32_MIN))
+#define VECTOR_FLIP64_SSE2(x) _mm_xor_si128(x, _mm_set1_epi64x(INT64_MIN))
+#define VECTOR_PS_SSE2(x) _mm_castsi128_ps(x)
+#define VECTOR_PD_SSE2(x) _mm_castsi128_pd(x)
+
+VECTOR_DEFINE_OPS(sse2, VECTOR_SSE2, __m128i, i8, int8_t, _mm_set1_epi8(x), _mm_cmpeq_epi8(a, b),
+                  vector_bits_sse2(_mm_cmpeq_epi8(a, b)),
+                  vector_select_sse2(_mm_cmpgt_epi8(a, b), b, a), vector_select_sse2(_mm_cmpgt_epi8(a, b), a, b),
+                  // 加上128变成无符号数后按8字节一组求和，再减掉每组多加的8×128
+                  _mm_add_epi64(acc, _mm_sub_epi64(_mm_sad_epu8(_mm_xor_si128(v, _mm_set1_epi8(INT8_MIN)), _mm_setzero_si128()),
+                                                   _mm_set1_epi64x(8 * 128))))
+VECTOR_DEFINE_OPS(sse2, VECTOR_SSE2, __m128i, u8, uint8_t, _mm_set1_epi8((char)x), _mm_cmpeq_epi8(a, b),
+                  vector_bits_sse2(_mm_cmpeq_epi8(a, b)), _mm_min_epu8(a, b), _mm_max_epu8(a, b),
+                  _mm_add_epi64(acc, _mm_sad_epu8(v, _mm_setzero_si128())))
+VECTOR_DEFINE_OPS(sse2, VECTOR_SSE2, __m128i, i16, int16_t, _mm_set1_epi16(x), _mm_cmpeq_epi16(a, b),
+                  vector_bits_sse2(_mm_cmpeq_epi16(a, b)), _mm_min_epi16(a, b), _mm_max_epi16(a, b),
+                  vector_widen32_sse2(acc, _mm_madd_epi16(v, _mm_set1_epi16(1))))
+VECTOR_DEFINE_OPS(sse2, VECTOR_SSE2, __m128i, u16, uint16_t, _mm_set1_epi16((short)x), _mm_cmpeq_epi16(a, b),
+                  vector_bits_sse2(_mm_cmpeq_epi16(a, b)),
+                  VECTOR_FLIP16_SSE2(_mm_min_epi16(VECTOR_FLIP16_SSE2(a), VECTOR_FLIP16_SSE2(b))),
+                  VECTOR_FLIP16_SSE2(_mm_max_epi16(VECTOR_FLIP16_SSE2(a), VECTOR_FLIP16_SSE2(b))),
+                  // 减去32768后两两求和，每个64位车道收到两个和，各补回2×32768
+                  _mm_add_epi64(vector_widen32_sse2(acc, _mm_madd_epi16(VECTOR_FLIP16_SSE2(v), _mm_set1_epi16(1))),
+                                _mm_set1_epi64x(4 * 32768)))
+VECTOR_DEFINE_OPS(sse2, VECTOR_SSE2, __m128i, i32, int32_t, _mm_set1_epi32(x), _mm_cmpeq_epi32(a, b),
+                  vector_bits_sse2(_mm_cmpeq_epi32(a, b)),
+                  vector_select_sse2(_mm_cmpgt_epi32(a, b), b, a), vector_select_sse2(_mm_cmpgt_epi32(a, b), a, b),
+                  vector_widen32_sse2(acc, v))
+VECTOR_DEFINE_OPS(sse2, VECTOR_SSE2, __m128i, u32, uint32_t, _mm_set1_epi32((int)x), _mm_cmpeq_epi32(a, b),
+                  vector_bits_sse2(_mm_cmpeq_epi32(a, b)),
+                  vector_select_sse2(_mm_cmpgt_epi32(VECTOR_FLIP32_SSE2(a), VECTOR_FLIP32_SSE2(b)), b, a),
+                  vector_select_sse2(_mm_cmpgt_epi32(VECTOR_FLIP32_SSE2(a), VECTOR_FLIP32_SSE2(b)), a, b),
+                  _mm_add_epi64(acc, _mm_add_epi64(_mm_unpacklo_epi32(v, _mm_setzero_si128()),
+                                                   _mm_unpackhi_epi32(v, _mm_setzero_si128()))))
+VECTOR_DEFINE_OPS(sse2, VECTOR_SSE2, __m128i, i64, int64_t, _mm_set1_epi64x(x), vector_eq64_sse2(a, b),
+                  vector_bits_sse2(vector_eq64_sse2(a, b)),
+                  vector_select_sse2(vector_gt64_sse2(a, b), b, a), vector_select_sse2(vector_gt64_sse2(a, b), a, b),
+                  _mm_add_epi64(acc, v))
+VECTOR_DEFINE_OPS(sse2, VECTOR_SSE2, __m128i, u64, uint64_t, _mm_set1_epi64x((long long)x), vector_eq64_sse2(a, b),
+                  vector_bits_sse2(vector_eq64_sse2(a, b)),
+                  vector_select_sse2(vector_gt64_sse2(VECTOR_FLIP64_SSE2(a), VECTOR_FLIP64_SSE2(b)), b, a),
+                  vector_select_sse2(vector_gt64_sse2(VECTOR_FLIP64_SSE2(a), VECTOR_FLIP64_SSE2(b)), a, b),
+                  _mm_add_epi64(acc, v))
+VECTOR_DEFINE_OPS(sse2, VECTOR_SSE2, __m128i, f32, float, _mm_castps_si128(_mm_set1_ps(x)),
+                  _mm_castps_si128(_mm_cmpeq_ps(VECTOR_PS_SSE2(a), VECTOR_PS_SSE2(b))),
+                  vector_bits_sse2(_mm_castps_si128(_mm_cmpeq_ps(VECTOR_PS_SSE2(a), VECTOR_PS_SSE2(b)))),
+                  _mm_castps_si128(_mm_min_ps(VECTOR_PS_SSE2(a), VECTOR_PS_SSE2(b))),
+                  _mm_castps_si128(_mm_max_ps(VECTOR_PS_SSE2(a), VECTOR_PS_SSE2(b))),
+                  _mm_castpd_si128(_mm_add_pd(_mm_add_pd(VECTOR_PD_SSE2(acc), _mm_cvtps_pd(VECTOR_PS_SSE2(v))),
+                                              _mm_cvtps_pd(_mm_movehl_ps(VECTOR_PS_SSE2(v), VECTOR_PS_SSE2(v))))))
+VECTOR_DEFINE_OPS(sse2, VECTOR_SSE2, __m128i, f64, double, _mm_castpd_si128(_mm_set1_pd(x)),
+                  _mm_castpd_si128(_mm_cmpeq_pd(VECTOR_PD_SSE2(a), VECTOR_PD_SSE2(b))),
+                  vector_bits_sse2(_mm_castpd_si128(_mm_cmpeq_pd(VECTOR_PD_SSE2(a), VECTOR_PD_SSE2(b)))),
+                  _mm_castpd_si128(_mm_min_pd(VECTOR_PD_SSE2(a), VECTOR_PD_SSE2(b))),
+                  _mm_castpd_si128(_mm_max_pd(VECTOR_PD_SSE2(a), VECTOR_PD_SSE2(b))),
+                  _mm_castpd_si128(_mm_add_pd(VECTOR_PD_SSE2(acc), VECTOR_PD_SSE2(v))))
+
+// ---- AVX2：只有64位最值需要用比较加混合拼出来 ----
+
+VECTOR_AVX2 static inline __m256i vector_load_avx2(const void *p) { return _mm256_loadu_si256((const __m256i *)p); }
+VECTOR_AVX2 static inline __m256i vector_zero_avx2(void) { return _mm256_setzero_si256(); }
+VECTOR_AVX2 static inline __m256i vector_sub8_avx2(__m256i a, __m256i b) { return _mm256_sub_epi8(a, b); }
+VECTOR_AVX2 static inline uint64_t vector_bits_avx2(__m256i m) { return (unsigned)_mm256_movemask_epi8(m); }
+
+/// @brief 各字节（无符号）之和
+VECTOR_AVX2 static inline uint64_t vector_sumbytes_avx2(__m256i x)
+{
+    uint64_t lanes[4];
+    _mm256_storeu_si256((__m256i *)lanes, _mm256_sad_epu8(x, _mm256_setzero_si256()));
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3];
+}
+
+/// @brief 把8个有符号32位整数符号扩展后加进acc的四个64位车道
+VECTOR_AVX2 static inline __m256i vector_widen32_avx2(__m256i acc, __m256i v)
+{
+    __m256i lo = _mm256_cvtepi32_epi64(_mm256_castsi256_si128(v)), hi = _mm256_cvtepi32_epi64(_mm256_extracti128_si256(v, 1));
+    return _mm256_add_epi64(acc, _mm256_add_epi64(lo, hi));
+}
+
+/// @brief 把8个无符号32位整数零扩展后加进acc的四个64位车道
+VECTOR_AVX2 static inline __m256i vector_widenu32_avx2(__m256i acc, __m256i v)
+{
+    __m256i lo = _mm256_cvtepu32_epi64(_mm256_castsi256_si128(v)), hi = _mm256_cvtepu32_epi64(_mm256_extracti128_si256(v, 1));
+    return _mm256_add_epi64(acc, _mm256_add_epi64(lo, hi));
+}
+
+#define VECTOR_FLIP64_AVX2(x) _mm256_xor_si256(x, _mm256_set1_epi64x(INT64_MIN))
+#define VECTOR_PS_AVX2(x) _mm256_castsi256_ps(x)
+#define VECTOR_PD_AVX2(x) _mm256_castsi256_pd(x)
+
+VECTOR_DEFINE_OPS(avx2, VECTOR_AVX2, __m256i, i8, int8_t, _mm256_set1_epi8(x), _mm256_cmpeq_epi8(a, b),
+                  vector_bits_avx2(_mm256_cmpeq_epi8(a, b)), _mm256_min_epi8(a, b), _mm256_max_epi8(a, b),
+                  _mm256_add_epi64(acc, _mm256_sub_epi64(_mm256_sad_epu8(_mm256_xor_si256(v, _mm256_set1_epi8(INT8_MIN)),
+                                                                         _mm256_setzero_si256()),
+                                                         _mm256_set1_epi64x(8 * 128))))
+VECTOR_DEFINE_OPS(avx2, VECTOR_AVX2, __m256i, u8, uint8_t, _mm256_set1_epi8((char)x), _mm256_cmpeq_epi8(a, b),
+                  vector_bits_avx2(_mm256_cmpeq_epi8(a, b)), _mm256_min_epu8(a, b), _mm256_max_epu8(a, b),
+                  _mm256_add_epi64(acc, _mm256_sad_epu8(v, _mm256_setzero_si256())))
+VECTOR_DEFINE_OPS(avx2, VECTOR_AVX2, __m256i, i16, int16_t, _mm256_set1_epi16(x), _mm256_cmpeq_epi16(a, b),
+                  vector_bits_avx2(_mm256_cmpeq_epi16(a, b)), _mm256_min_epi16(a, b), _mm256_max_epi16(a, b),
+                  vector_widen32_avx2(acc, _mm256_madd_epi16(v, _mm256_set1_epi16(1))))
+VECTOR_DEFINE_OPS(avx2, VECTOR_AVX2, __m256i, u16, uint16_t, _mm256_set1_epi16((short)x), _mm256_cmpeq_epi16(a, b),
+                  vector_bits_avx2(_mm256_cmpeq_epi16(a, b)), _mm256_min_epu16(a, b), _mm256_max_epu16(a, b),
+                  _mm256_add_epi64(vector_widen32_avx2(acc, _mm256_madd_epi16(_mm256_xor_si256(v, _mm256_set1_epi16(INT16_MIN)),
+                                                                              _mm256_set1_epi16(1))),
+                                   _mm256_set1_epi64x(4 * 32768)))
+VECTOR_DEFINE_OPS(avx2, VECTOR_AVX2, __m256i, i32, int32_t, _mm256_set1_epi32(x), _mm256_cmpeq_epi32(a, b),
+                  vector_bits_avx2(_mm256_cmpeq_epi32(a, b)), _mm256_min_epi32(a, b), _mm256_max_epi32(a, b),
+                  vector_widen32_avx2(acc, v))
+VECTOR_DEFINE_OPS(avx2, VECTOR_AVX2, __m256i, u32, uint32_t, _mm256_set1_epi32((int)x), _mm256_cmpeq_epi32(a, b),
+                  vector_bits_avx2(_mm256_cmpeq_epi32(a, b)), _mm256_min_epu32(a, b), _mm256_max_epu32(a, b),
+                  vector_widenu32_avx2(acc, v))
+VECTOR_DEFINE_OPS(avx2, VECTOR_AVX2, __m256i, i64, int64_t, _mm256_set1_epi64x(x), _mm256_cmpeq_epi64(a, b),
+                  vector_bits_avx2(_mm256_cmpeq_epi64(a, b)),
+                  _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(a, b)), _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(a, b)),
+                  _mm256_add_epi64(acc, v))
+VECTOR_DEFINE_OPS(avx2, VECTOR_AVX2, __m256i, u64, uint64_t, _mm256_set1_epi64x((long long)x), _mm256_cmpeq_epi64(a, b),
+                  vector_bits_avx2(_mm256_cmpeq_epi64(a, b)),
+                  _mm256_blendv_epi8(a, b, _mm256_cmpgt_epi64(VECTOR_FLIP64_AVX2(a), VECTOR_FLIP64_AVX2(b))),
+                  _mm256_blendv_epi8(b, a, _mm256_cmpgt_epi64(VECTOR_FLIP64_AVX2(a), VECTOR_FLIP64_AVX2(b))),
+                  _mm256_add_epi64(acc, v))
+VECTOR_DEFINE_OPS(avx2, VECTOR_AVX2, __m256i, f32, float, _mm256_castps_si256(_mm256_set1_ps(x)),
+                  _mm256_castps_si256(_mm256_cmp_ps(VECTOR_PS_AVX2(a), VECTOR_PS_AVX2(b), _CMP_EQ_OQ)),
+                  vector_bits_avx2(_mm256_castps_si256(_mm256_cmp_ps(VECTOR_PS_AVX2(a), VECTOR_PS_AVX2(b), _CMP_EQ_OQ))),
+                  _mm256_castps_si256(_mm256_min_ps(VECTOR_PS_AVX2(a), VECTOR_PS_AVX2(b))),
+                  _mm256_castps_si256(_mm256_max_ps(VECTOR_PS_AVX2(a), VECTOR_PS_AVX2(b))),
+                  _mm256_castpd_si256(_mm256_add_pd(_mm256_add_pd(VECTOR_PD_AVX2(acc), _mm256_cvtps_pd(_mm256_castps256_ps128(VECTOR_PS_AVX2(v)))),
+                                                    _mm256_cvtps_pd(_mm256_extractf128_ps(VECTOR_PS_AVX2(v), 1)))))
+VECTOR_DEFINE_OPS(avx2, VECTOR_AVX2, __m256i, f64, double, _mm256_castpd_si256(_mm256_set1_pd(x)),
+                  _mm256_castpd_si256(_mm256_cmp_pd(VECTOR_PD_AVX2(a), VECTOR_PD_AVX2(b), _CMP_EQ_OQ)),
+                  vector_bits_avx2(_mm256_castpd_si256(_mm256_cmp_pd(VECTOR_PD_AVX2(a), VECTOR_PD_AVX2(b), _CMP_EQ_OQ))),
+                  _mm256_castpd_si256(_mm256_min_pd(VECTOR_PD_AVX2(a), VECTOR_PD_AVX2(b))),
+                  _mm256_castpd_si256(_mm256_max_pd(VECTOR_PD_AVX2(a), VECTOR_PD_AVX2(b))),
+                  _mm256_castpd_si256(_mm256_add_pd(VECTOR_PD_AVX2(acc), VECTOR_PD_AVX2(v))))
+
+// ---- AVX-512：比较直接得到车道掩码，所有宽度都有原生的最值 ----
+
+VECTOR_AVX512 static inline __m512i vector_load_avx512(const void *p) { return _mm512_loadu_si512(p); }
+VECTOR_AVX512 static inline __m512i vector_zero_avx512(void) { return _mm512_setzero_si512(); }
+VECTOR_AVX512 static inline __m512i vector_sub8_avx512(__m512i a, __m512i b) { return _mm512_sub_epi8(a, b); }
+
+/// @brief 各字节（无符号）之和
+VECTOR_AVX512 static inline uint64_t vector_sumbytes_avx512(__m512i x)
+{
+    return (uint64_t)_mm512_reduce_add_epi64(_mm512_sad_epu8(x, _mm512_setzero_si512()));
+}
+
+/// @brief 把16个有符号32位整数符号扩展后加进acc的八个64位车道
+VECTOR_AVX512 static inline __m512i vector_widen32_avx512(__m512i acc, __m512i v)
+{
+    __m512i lo = _mm512_cvtepi32_epi64(_mm512_castsi512_si256(v)), hi = _mm512_cvtepi32_epi64(_mm512_extracti64x4_epi64(v, 1));
+    return _mm512_add_epi64(acc, _mm512_add_epi64(lo, hi));
+}
+
+/// @brief 把16个无符号32位整数零扩展后加进acc的八个64位车道
+VECTOR_AVX512 static inline __m512i vector_widenu32_avx512(__m512i acc, __m512i v)
+{
+    __m512i lo = _mm512_cvtepu32_epi64(_mm512_castsi512_si256(v)), hi = _mm512_cvtepu32_epi64(_mm512_extracti64x4_epi64(v, 1));
+    return _mm512_add_epi64(acc, _mm512_add_epi64(lo, hi));
+}
+
+#define VECTOR_PS_AVX512(x) _mm512_castsi512_ps(x)
+#define VECTOR_PD_AVX512(x) _mm512_castsi512_pd(x)
+
+VECTOR_DEFINE_OPS(avx512, VECTOR_AVX512, __m512i, i8, int8_t, _mm512_set1_epi8(x), _mm512_movm_epi8(_mm512_cmpeq_epi8_mask(a, b)),
+                  _mm512_cmpeq_epi8_mask(a, b), _mm512_min_epi8(a, b), _mm512_max_epi8(a, b),
+                  _mm512_add_epi64(acc, _mm512_sub_epi64(_mm512_sad_epu8(_mm512_xor_si512(v, _mm512_set1_epi8(INT8_MIN)),
+                                                                         _mm512_setzero_si512()),
+                                                         _mm512_set1_epi64(8 * 128))))
+VECTOR_DEFINE_OPS(avx512, VECTOR_AVX512, __m512i, u8, uint8_t, _mm512_set1_epi8((char)x), _mm512_movm_epi8(_mm512_cmpeq_epi8_mask(a, b)),
+                  _mm512_cmpeq_epi8_mask(a, b), _mm512_min_epu8(a, b), _mm512_max_epu8(a, b),
+                  _mm512_add_epi64(acc, _mm512_sad_epu8(v, _mm512_setzero_si512())))
+VECTOR_DEFINE_OPS(avx512, VECTOR_AVX512, __m512i, i16, int16_t, _mm512_set1_epi16(x), _mm512_movm_epi16(_mm512_cmpeq_epi16_mask(a, b)),
+                  _mm512_cmpeq_epi16_mask(a, b), _mm512_min_epi16(a, b), _mm512_max_epi16(a, b),
+                  vector_widen32_avx512(acc, _mm512_madd_epi16(v, _mm512_set1_epi16(1))))
+VECTOR_DEFINE_OPS(avx512, VECTOR_AVX512, __m512i, u16, uint16_t, _mm512_set1_epi16((short)x), _mm512_movm_epi16(_mm512_cmpeq_epi16_mask(a, b)),
+                  _mm512_cmpeq_epi16_mask(a, b), _mm512_min_epu16(a, b), _mm512_max_epu16(a, b),
+                  _mm512_add_epi64(vector_widen32_avx512(acc, _mm512_madd_epi16(_mm512_xor_si512(v, _mm512_set1_epi16(INT16_MIN)),
+                                                                                _mm512_set1_epi16(1))),
+                                   _mm512_set1_epi64(4 * 32768)))
+VECTOR_DEFINE_OPS(avx512, VECTOR_AVX512, __m512i, i32, int32_t, _mm512_set1_epi32(x), _mm512_movm_epi32(_mm512_cmpeq_epi32_mask(a, b)),
+                  _mm512_cmpeq_epi32_mask(a, b), _mm512_min_epi32(a, b), _mm512_max_epi32(a, b),
+                  vector_widen32_avx512(acc, v))
+VECTOR_DEFINE_OPS(avx512, VECTOR_AVX512, __m512i, u32, uint32_t, _mm512_set1_epi32((int)x), _mm512_movm_epi32(_mm512_cmpeq_epi32_mask(a, b)),
+                  _mm512_cmpeq_epi32_mask(a, b), _mm512_min_epu32(a, b), _mm512_max_epu32(a, b),
+                  vector_widenu32_avx512(acc, v))
+VECTOR_DEFINE_OPS(avx512, VECTOR_AVX512, __m512i, i64, int64_t, _mm512_set1_epi64(x), _mm512_movm_epi64(_mm512_cmpeq_epi64_mask(a, b)),
+                  _mm512_cmpeq_epi64_mask(a, b), _mm512_min_epi64(a, b), _mm512_max_epi64(a, b),
+                  _mm512_add_epi64(acc, v))
+VECTOR_DEFINE_OPS(avx512, VECTOR_AVX512, __m512i, u64, uint64_t, _mm512_set1_epi64((long long)x), _mm512_movm_epi64(_mm512_cmpeq_epi64_mask(a, b)),
+                  _mm512_cmpeq_epi64_mask(a, b), _mm512_min_epu64(a, b), _mm512_max_epu64(a, b),
+                  _mm512_add_epi64(acc, v))
+VECTOR_DEFINE_OPS(avx512, VECTOR_AVX512, __m512i, f32, float, _mm512_castps_si512(_mm512_set1_ps(x)),
+                  _mm512_movm_epi32(_mm512_cmp_ps_mask(VECTOR_PS_AVX512(a), VECTOR_PS_AVX512(b), _CMP_EQ_OQ)),
+                  _mm512_cmp_ps_mask(VECTOR_PS_AVX512(a), VECTOR_PS_AVX512(b), _CMP_EQ_OQ),
+                  _mm512_castps_si512(_mm512_min_ps(VECTOR_PS_AVX512(a), VECTOR_PS_AVX512(b))),
+                  _mm512_castps_si512(_mm512_max_ps(VECTOR_PS_AVX512(a), VECTOR_PS_AVX512(b))),
+                  _mm512_castpd_si512(_mm512_add_pd(_mm512_add_pd(VECTOR_PD_AVX512(acc), _mm512_cvtps_pd(_mm512_castps512_ps256(VECTOR_PS_AVX512(v)))),
+                                                    _mm512_cvtps_pd(_mm256_castsi256_ps(_mm512_extracti64x4_epi64(v, 1))))))
+VECTOR_DEFINE_OPS(avx512, VECTOR_AVX512, __m512i, f64, double, _mm512_castpd_si512(_mm512_set1_pd(x)),
+                  _mm512_movm_epi64(_mm512_cmp_pd_mask(VECTOR_PD_AVX512(a), VECTOR_PD_AVX512(b), _CMP_EQ_OQ)),
+                  _mm512_cmp_pd_mask(VECTOR_PD_AVX512(a), VECTOR_PD_AVX512(b), _CMP_EQ_OQ),
+                  _mm512_castpd_si512(_mm512_min_pd(VECTOR_PD_AVX512(a), VECTOR_PD_AVX512(b))),
+                  _mm512_castpd_si512(_mm512_max_pd(VECTOR_PD_AVX512(a), VECTOR_PD_AVX512(b))),
+                  _mm512_castpd_si512(_mm512_add_pd(VECTOR_PD_AVX512(acc), VECTOR_PD_AVX512(v))))
+
+/// eqbits中每个元素占的位数：SSE2/AVX2的movemask每个字节一位，AVX-512的比较掩码每个车道一位
+#define VECTOR_MASK_BITS_sse2(T) sizeof(T)
+#define VECTOR_MASK_BITS_avx2(T) sizeof(T)
+#define VECTOR_MASK_BITS_avx512(T) 1
+
+/// 用上面的基本运算生成一个元素类型在一种指令集下的四个内核，每次处理一个向量寄存器，不足一个寄存器的尾部逐个处理。
+/// 计数、最值和求和的中间结果一直按车道留在寄存器中，扫描结束后才合并各车道，因此浮点求和的舍入与逐个相加略有不同。
+#define VECTOR_DEFINE_KERNELS(ISA, ATTR, V, T, E, TN, ACC, W)                                            \
+    ATTR static size_t vector_find_##TN##_##ISA(const void *data, size_t n, const void *value)           \
+    {                                                                                                    \
+        enum { L = sizeof(V) / sizeof(T) };                                                              \
+        const T *p = (const T *)data;                                                                    \
+        const T v = *(const T *)value;                                                                   \
+        const V key = vector_set1_##TN##_##ISA(v);                                                       \
+        size_t i = 0;                                                                                    \
+        for (; i + L <= n; i += L)                                                                       \
+        {                                                                                                \
+            uint64_t hit = vector_eqbits_##TN##_##ISA(vector_load_##ISA(p + i), key);                    \
+            if (hit)                                                                                     \
+                return i + __builtin_ctzll(hit) / VECTOR_MASK_BITS_##ISA(T);                             \
+        }                                                                                                \
+        for (; i < n; ++i)                                                                               \
+            if (p[i] == v)                                                                               \
+                return i;                                                                                \
+        return VECTOR_NPOS;                                                                              \
+    }                                                                                                    \
+                                                                                                         \
+    ATTR static size_t vector_count_##TN##_##ISA(const void *data, size_t n, const void *value)          \
+    {                                                                                                    \
+        enum { L = sizeof(V) / sizeof(T) };                                                              \
+        const T *p = (const T *)data;                                                                    \
+        const T v = *(const T *)value;                                                                   \
+        const V key = vector_set1_##TN##_##ISA(v);                                                       \
+        size_t i = 0, count = 0, whole = n - n % L;                                                      \
+        while (i < whole)                                                                                \
+        {                                                                                                \
+            /* 每个字节一个计数器：相等的车道全为1即-1，减去它使该元素的每个字节都加一； */                                                 \
+            /* 字节计数器最多累加255次，之后求和合并进count */                                                             \
+            V bytes = vector_zero_##ISA();                                                               \
+            size_t stop = whole - i > 255 * (size_t)L ? i + 255 * (size_t)L : whole;                     \
+            for (; i < stop; i += L)                                                                     \
+                bytes = vector_sub8_##ISA(bytes, vector_eq_##TN##_##ISA(vector_load_##ISA(p + i), key)); \
+            count += vector_sumbytes_##ISA(bytes) / sizeof(T);                                           \
+        }                                                                                                \
+        for (; i < n; ++i)                                                                               \
+            count += p[i] == v;                                                                          \
+        return count;                                                                                    \
+    }                                                                                                    \
+                                                                                                         \
+    ATTR static void vector_minmax_##TN##_##ISA(const void *data, size_t n, void *min, void *max)        \
+    {                                                                                                    \
+        enum { L = sizeof(V) / sizeof(T) };                                                              \
+        const T *p = (const T *)data;                                                                    \
+        T lo = p[0], hi = p[0];                                                                          \
+        size_t i = 0;                                                                                    \
+        if (n >= L)                                                                                      \
+        {                                                                                                \
+            /* 两组互不依赖的最值寄存器交替使用，比较不必等上一次的结果 */                                                           \
+            V lo0 = vector_load_##ISA(p), hi0 = lo0, lo1 = lo0, hi1 = lo0;                               \
+            for (i = L; i + 2 * L <= n; i += 2 * L)                                                      \
+            {                                                                                            \
+                V x0 = vector_load_##ISA(p + i), x1 = vector_load_##ISA(p + i + L);                      \
+                lo0 = vector_min_##TN##_##ISA(lo0, x0);                                                  \
+                hi0 = vector_max_##TN##_##ISA(hi0, x0);                                                  \
+                lo1 = vector_min_##TN##_##ISA(lo1, x1);                                                  \
+                hi1 = vector_max_##TN##_##ISA(hi1, x1);                                                  \
+            }                                                                                            \
+            for (; i + L <= n; i += L)                                                                   \
+            {                                                                                            \
+                V x = vector_load_##ISA(p + i);                                                          \
+                lo0 = vector_min_##TN##_##ISA(lo0, x);                                                   \
+                hi0 = vector_max_##TN##_##ISA(hi0, x);                                                   \
+            }                                                                                            \
+            lo0 = vector_min_##TN##_##ISA(lo0, lo1);                                                     \
+            hi0 = vector_max_##TN##_##ISA(hi0, hi1);                                                     \
+            T lanes[2][L];                                                                               \
+            memcpy(lanes[0], &lo0, sizeof(V));                                                           \
+            memcpy(lanes[1], &hi0, sizeof(V));                                                           \
+            for (size_t j = 0; j < L; ++j)                                                               \
+            {                                                                                            \
+                lo = lanes[0][j] < lo ? lanes[0][j] : lo;                                                \
+                hi = lanes[1][j] > hi ? lanes[1][j] : hi;                                                \
+            }                                                                                            \
+        }                                                                                                \
+        for (; i < n; ++i)                                                                               \
+        {                                                                                                \
+            lo = p[i] < lo ? p[i] : lo;                                                                  \
+            hi = p[i] > hi ? p[i] : hi;                                                                  \
+        }                                                                                                \
+        *(T *)min = lo;                                                                                  \
+        *(T *)max = hi;                                                                                  \
+    }                                                                                                    \
+                                                                                                         \
+    ATTR static void vector_sum_##TN##_##ISA(const void *data, size_t n, void *sum)                      \
+    {                                                                                                    \
+        enum { L = sizeof(V) / sizeof(T), A = sizeof(V) / sizeof(W) };                                   \
+        const T *p = (const T *)data;                                                                    \
+        /* 四个互不依赖的累加器，浮点加法的延迟可以重叠 */                                                                     \
+        V acc[4] = {vector_zero_##ISA(), vector_zero_##ISA(), vector_zero_##ISA(), vector_zero_##ISA()}; \
+        size_t i = 0;                                                                                    \
+        for (; i + 4 * L <= n; i += 4 * L)                                                               \
+        {                                                                                                \
+            acc[0] = vector_add_##TN##_##ISA(acc[0], vector_load_##ISA(p + i));                          \
+            acc[1] = vector_add_##TN##_##ISA(acc[1], vector_load_##ISA(p + i + L));                      \
+            acc[2] = vector_add_##TN##_##ISA(acc[2], vector_load_##ISA(p + i + 2 * L));                  \
+            acc[3] = vector_add_##TN##_##ISA(acc[3], vector_load_##ISA(p + i + 3 * L));                  \
+        }                                                                                                \
+        for (; i + L <= n; i += L)                                                                       \
+            acc[0] = vector_add_##TN##_##ISA(acc[0], vector_load_##ISA(p + i));                          \
+        W lanes[4 * A], total = 0;                                                                       \
+        memcpy(lanes, acc, sizeof(acc));                                                                 \
+        for (size_t j = 0; j < 4 * A; ++j)                                                               \
+            total += lanes[j];                                                                           \
+        for (; i < n; ++i)                                                                               \
+            total += (W)p[i];                                                                            \
+        *(ACC *)sum = (ACC)total;                                                                        \
+    }
+#else
+/// 没有可用的向量指令集时的内核：逐个元素处理
+#define VECTOR_DEFINE_KERNELS(ISA, ATTR, V, T, E, TN, ACC, W)                                \
+    static size_t vector_find_##TN##_##ISA(const void *data, size_t n, const void *value)    \
+    {                                                                                        \
+        const T *p = (const T *)data;                                                        \
+        const T v = *(const T *)value;                                                       \
+        for (size_t i = 0; i < n; ++i)                                                       \
+            if (p[i] == v)                                                                   \
+                return i;                                                                    \
+        return VECTOR_NPOS;                                                                  \
+    }                                                                                        \
+                                                                                             \
+    static size_t vector_count_##TN##_##ISA(const void *data, size_t n, const void *value)   \
+    {                                                                                        \
+        const T *p = (const T *)data;                                                        \
+        const T v = *(const T *)value;                                                       \
+        size_t count = 0;                                                                    \
+        for (size_t i = 0; i < n; ++i)                                                       \
+            count += p[i] == v;                                                              \
+        return count;                                                                        \
+    }                                                                                        \
+                                                                                             \
+    static void vector_minmax_##TN##_##ISA(const void *data, size_t n, void *min, void *max) \
+    {                                                                                        \
+        const T *p = (const T *)data;                                                        \
+        T lo = p[0], hi = p[0];                                                              \
+        for (size_t i = 1; i < n; ++i)                                                       \
+        {                                                                                    \
+            lo = p[i] < lo ? p[i] : lo;                                                      \
+            hi = p[i] > hi ? p[i] : hi;                                                      \
+        }                                                                                    \
+        *(T *)min = lo;                                                                      \
+        *(T *)max = hi;                                                                      \
+    }                                                                                        \
+                                                                                             \
+    static void vector_sum_##TN##_##ISA(const void *data, size_t n, void *sum)               \
+    {                                                                                        \
+        const T *p = (const T *)data;                                                        \
+        W total = 0;                                                                         \
+        for (size_t i = 0; i < n; ++i)                                                       \
+            total += (W)p[i];                                                                \
+        *(ACC *)sum = (ACC)total;                                                            \
+    }
+#endif
+
+#define VECTOR_TABLE_FIND(ISA, ATTR, V, T, E, TN, ACC, W) [E] = vector_find_##TN##_##ISA,
+#define VECTOR_TABLE_COUNT(ISA, ATTR, V, T, E, TN, ACC, W) [E] = vector_count_##TN##_##ISA,
+#define VECTOR_TABLE_MINMAX(ISA, ATTR, V, T, E, TN, ACC, W) [E] = vector_minmax_##TN##_##ISA,
+#define VECTOR_TABLE_SUM(ISA, ATTR, V, T, E, TN, ACC, W) [E] = vector_sum_##TN##_##ISA,
+
+/// 生成一种指令集下的全部内核以及它们的函数表vector_kernels_##ISA，V为该指令集的整数向量类型
+#define VECTOR_DEFINE_ISA(ISA, ATTR, V)                            \
+    VECTOR_FOR_EACH_TYPE(VECTOR_DEFINE_KERNELS, ISA, ATTR, V)      \
+    static const VectorKernels vector_kernels_##ISA = {            \
+        {VECTOR_FOR_EACH_TYPE(VECTOR_TABLE_FIND, ISA, ATTR, V)},   \
+        {VECTOR_FOR_EACH_TYPE(VECTOR_TABLE_COUNT, ISA, ATTR, V)},  \
+        {VECTOR_FOR_EACH_TYPE(VECTOR_TABLE_MINMAX, ISA, ATTR, V)}, \
+        {VECTOR_FOR_EACH_TYPE(VECTOR_TABLE_SUM, ISA, ATTR, V)},    \
+    };
+
+#ifdef VECTOR_X86_SIMD
+VECTOR_DEFINE_ISA(sse2, VECTOR_SSE2, __m128i)
+VECTOR_DEFINE_ISA(avx2, VECTOR_AVX2, __m256i)
+VECTOR_DEFINE_ISA(avx512, VECTOR_AVX512, __m512i)
+#else
+VECTOR_DEFINE_ISA(scalar, , void)
+#endif
+
+/// @brief 按CPU支持的指令集选择内核表，结果只计算一次
+static const VectorKernels *vector_kernels(void)
+{
+    static const VectorKernels *cached = NULL;
+    const VectorKernels *kernels = __atomic_load_n(&cached, __ATOMIC_RELAXED);
+    if (kernels == NULL)
+    {
+#ifdef VECTOR_X86_SIMD
+        __builtin_cpu_init();
+        if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw") &&
+            __builtin_cpu_supports("avx512dq") && __builtin_cpu_supports("avx512vl"))
+            kernels = &vector_kernels_avx512;
+        else if (__builtin_cpu_supports("avx2"))
+            kernels = &vector_kernels_avx2;
+        else
+            kernels = &vector_kernels_sse2;
+#else
+        kernels = &vector_kernels_scalar;
+#endif
+        __atomic_store_n(&cached, kernels, __ATOMIC_RELAXED); // 各线程算出的结果相同，重复写入无妨
+    }
+    return kernels;
+}
+
+/// @brief 检查元素类型与向量的元素大小是否一致
+static bool vector_check_type(const Vector *this, VectorElemType type, const char *name)
+{
+    if ((unsigned)type >= VECTOR_ELEM_TYPE_COUNT || vector_elem_size[type] != this->valueSize)
+    {
+        fprintf(stderr, "%s: element type does not match vector value size %zu.\n", name, this->valueSize);
+        return false;
+    }
+    return true;
+}
+
+/**
+ * @brief 在向量中查找第一个等于value的元素。
+ *
+ * @param this 指向要查找的向量结构体的指针。
+ * @param type 元素类型，其大小必须等于向量的valueSize。
+ * @param value 指向要查找的值的指针，按type解释。
+ * @note 按CPU在运行时选择AVX-512/AVX2/SSE2内核，每次比较一整块元素；浮点数按数值比较，因此NaN永远找不到，0.0和-0.0视为相等。
+ * @return size_t 第一个相等元素的下标；没有找到或元素类型与向量不符时返回VECTOR_NPOS。
+ */
+size_t VectorFind(const Vector *this, VectorElemType type, const void *value)
+{
+    if (!vector_check_type(this, type, "VectorFind"))
+        return VECTOR_NPOS;
+    return vector_kernels()->find[type](this->data, this->len, value);
+}
+
+/**
+ * @brief 统计向量中等于value的元素个数。
+ *
+ * @param this 指向要统计的向量结构体的指针。
+ * @param type 元素类型，其大小必须等于向量的valueSize。
+ * @param value 指向要比较的值的指针，按type解释；浮点数按数值比较。
+ * @return size_t 相等元素的个数；元素类型与向量不符时返回0。
+ */
+size_t VectorCount(const Vector *this, VectorElemType type, const void *value)
+{
+    if (!vector_check_type(this, type, "VectorCount"))
+        return 0;
+    return vector_kernels()->count[type](this->data, this->len, value);
+}
+
+/**
+ * @brief 一次扫描求出向量中的最小值和最大值。
+ *
+ * @param this 指向要扫描的向量结构体的指针。
+ * @param type 元素类型，其大小必须等于向量的valueSize。
+ * @param min 存放最小值的地址，按type写入一个元素。
+ * @param max 存放最大值的地址，按type写入一个元素。
+ * @note 向量中含有NaN时结果没有定义。
+ * @return bool 成功返回`true`；向量为空或元素类型与向量不符时返回`false`，此时min和max不被修改。
+ */
+bool VectorMinMax(const Vector *this, VectorElemType type, void *min, void *max)
+{
+    if (!vector_check_type(this, type, "VectorMinMax") || this->len == 0)
+        return false;
+    vector_kernels()->minmax[type](this->data, this->len, min, max);
+    return true;
+}
+
+/**
+ * @brief 求向量中全部元素的和。
+ *
+ * @param this 指向要求和的向量结构体的指针。
+ * @param type 元素类型，其大小必须等于向量的valueSize。
+ * @param sum 存放结果的地址：有符号整数写入int64_t，无符号整数写入uint64_t（两者溢出时都按模2^64回绕），浮点数写入double。
+ * @note 各车道分别累加后再合并，浮点数的结果与逐个相加可能在最后几位上不同。空向量的和为0。
+ * @return bool 成功返回`true`；元素类型与向量不符时返回`false`。
+ */
+bool VectorSum(const Vector *this, VectorElemType type, void *sum)
+{
+    if (!vector_check_type(this, type, "VectorSum"))
+        return false;
+    vector_kernels()->sum[type](this->data, this->len, sum);
+    return true;
+}
+
+/**
+ * @brief 判断两个向量的内容是否相同。
+ *
+ * @param a 指向第一个向量结构体的指针。
+ * @param b 指向第二个向量结构体的指针。
+ * @note 按字节比较（memcmp本身已按CPU选择向量化实现），因此对浮点数而言NaN与自身相等，0.0与-0.0不相等；只比较前len个元素，不比较容量。
+ * @return bool 元素大小、元素个数和每个元素的字节都相同时返回`true`，否则返回`false`。
+ */
+bool VectorEqual(const Vector *a, const Vector *b)
+{
+    if (a->valueSize != b->valueSize || a->len != b->len)
+        return false;
+    return a->len == 0 || memcmp(a->data, b->data, a->len * a->valueSize) == 0;
+}
\ No newline at end of file
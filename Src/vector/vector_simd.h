@@ -0,0 +1,38 @@
+#ifndef __VECTOR_SIMD_H__
+#define __VECTOR_SIMD_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "vector.h"
+
+#define VECTOR_NPOS ((size_t)-1) // VectorFind没有找到时的返回值
+
+/// 扫描内核如何解释向量中的元素，元素大小必须与向量的valueSize一致
+typedef enum VectorElemType
+{
+    VECTOR_I8,
+    VECTOR_U8,
+    VECTOR_I16,
+    VECTOR_U16,
+    VECTOR_I32,
+    VECTOR_U32,
+    VECTOR_I64,
+    VECTOR_U64,
+    VECTOR_F32,
+    VECTOR_F64,
+    VECTOR_ELEM_TYPE_COUNT
+} VectorElemType;
+
+size_t VectorFind(const Vector *this, VectorElemType type, const void *value);
+
+size_t VectorCount(const Vector *this, VectorElemType type, const void *value);
+
+bool VectorMinMax(const Vector *this, VectorElemType type, void *min, void *max);
+
+bool VectorSum(const Vector *this, VectorElemType type, void *sum);
+
+bool VectorEqual(const Vector *a, const Vector *b);
+
+#endif
@@ -0,0 +1,488 @@
+/**
+ * @file vector_sort.h 相关函数实现
+ * @brief 此文件包含了向量（Vector）的排序：定宽数值键用LSD基数排序，任意元素配合比较函数用pdqsort风格的内省排序。
+ */
+
+#include "vector_sort.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/// 键提取排序中每个元素的（可按无符号整数比较的键，原下标）
+typedef struct VectorKeyIndex
+{
+    uint64_t key;
+    size_t index;
+} VectorKeyIndex;
+
+#define VECTOR_KEY_SELF(x) (x)
+#define VECTOR_KEY_PAIR(x) ((x).key)
+
+/// 生成一个按8位一趟的LSD基数排序：一次读取统计出所有趟的直方图，所有键在某一位上都相同的那一趟直接跳过，
+/// 在data和scratch之间来回搬运，最后结果不在data中时再复制回来。排序是稳定的。
+#define VECTOR_DEFINE_RADIX(NAME, T, KEY, BYTES)                                  \
+    static void NAME(T *data, T *scratch, size_t n)                               \
+    {                                                                             \
+        if (n < VECTOR_RADIX_MIN)                                                 \
+        {                                                                         \
+            for (size_t i = 1; i < n; ++i)                                        \
+            {                                                                     \
+                T x = data[i];                                                    \
+                size_t j = i;                                                     \
+                for (; j > 0 && KEY(data[j - 1]) > KEY(x); --j)                   \
+                    data[j] = data[j - 1];                                        \
+                data[j] = x;                                                      \
+            }                                                                     \
+            return;                                                               \
+        }                                                                         \
+        size_t counts[BYTES][256];                                                \
+        memset(counts, 0, sizeof(counts));                                        \
+        for (size_t i = 0; i < n; ++i)                                            \
+        {                                                                         \
+            uint64_t k = KEY(data[i]);                                            \
+            for (size_t d = 0; d < BYTES; ++d)                                    \
+                counts[d][(k >> (d * 8)) & 0xFF]++;                               \
+        }                                                                         \
+        T *src = data, *dst = scratch;                                            \
+        for (size_t d = 0; d < BYTES; ++d)                                        \
+        {                                                                         \
+            size_t *c = counts[d];                                                \
+            if (c[((uint64_t)KEY(src[0]) >> (d * 8)) & 0xFF] == n)                \
+                continue;                                                         \
+            size_t sum = 0;                                                       \
+            for (size_t b = 0; b < 256; ++b)                                      \
+            {                                                                     \
+                size_t t = c[b];                                                  \
+                c[b] = sum;                                                       \
+                sum += t;                                                         \
+            }                                                                     \
+            for (size_t i = 0; i < n; ++i)                                        \
+            {                                                                     \
+                T x = src[i];                                                     \
+                dst[c[((uint64_t)KEY(x) >> (d * 8)) & 0xFF]++] = x;               \
+            }                                                                     \
+            T *t = src;                                                           \
+            src = dst;                                                            \
+            dst = t;                                                              \
+        }                                                                         \
+        if (src != data)                                                          \
+            memcpy(data, src, n * sizeof(T));                                     \
+    }
+
+VECTOR_DEFINE_RADIX(vector_radix_u8, uint8_t, VECTOR_KEY_SELF, 1)
+VECTOR_DEFINE_RADIX(vector_radix_u16, uint16_t, VECTOR_KEY_SELF, 2)
+VECTOR_DEFINE_RADIX(vector_radix_u32, uint32_t, VECTOR_KEY_SELF, 4)
+VECTOR_DEFINE_RADIX(vector_radix_u64, uint64_t, VECTOR_KEY_SELF, 8)
+VECTOR_DEFINE_RADIX(vector_radix_pair, VectorKeyIndex, VECTOR_KEY_PAIR, 8)
+
+static const size_t vector_sort_elem_size[VECTOR_ELEM_TYPE_COUNT] = {1, 1, 2, 2, 4, 4, 8, 8, 4, 8};
+
+/// @brief 把宽度为bytes的位模式变换成按无符号整数比较即可得到正确顺序的键，back为true时做逆变换
+/// @note 有符号整数翻转符号位；浮点数为正时翻转符号位、为负时翻转所有位
+static inline uint64_t vector_order_bits(uint64_t u, VectorElemType type, size_t bytes, bool back)
+{
+    uint64_t sign = (uint64_t)1 << (bytes * 8 - 1);
+    uint64_t all = bytes == 8 ? UINT64_MAX : (sign << 1) - 1;
+    switch (type)
+    {
+    case VECTOR_I8:
+    case VECTOR_I16:
+    case VECTOR_I32:
+    case VECTOR_I64:
+        return u ^ sign;
+    case VECTOR_F32:
+    case VECTOR_F64:
+        if (back)
+            return u & sign ? u ^ sign : u ^ all;
+        return u & sign ? u ^ all : u ^ sign;
+    default:
+        return u;
+    }
+}
+
+#define VECTOR_ORDER_LOOP(UT, BYTES)                                                     \
+    for (size_t i = 0; i < n; ++i)                                                       \
+        ((UT *)data)[i] = (UT)vector_order_bits(((UT *)data)[i], type, BYTES, back)
+
+/**
+ * @brief 原地把n个元素的位模式变换成按无符号整数比较即可得到数值顺序的键，或者做逆变换。
+ *
+ * @param data 元素数组。
+ * @param n 元素个数。
+ * @param type 元素类型；无符号整数不需要变换。
+ * @param back 为`false`时变换成键，为`true`时从键变换回原值。
+ * @note 基数排序的预处理和后处理，也供并行排序对各块分别调用。
+ */
+void VectorOrderKeys(void *data, size_t n, VectorElemType type, bool back)
+{
+    if (type == VECTOR_U8 || type == VECTOR_U16 || type == VECTOR_U32 || type == VECTOR_U64)
+        return;
+    switch (vector_sort_elem_size[type])
+    {
+    case 1:
+        VECTOR_ORDER_LOOP(uint8_t, 1);
+        break;
+    case 2:
+        VECTOR_ORDER_LOOP(uint16_t, 2);
+        break;
+    case 4:
+        VECTOR_ORDER_LOOP(uint32_t, 4);
+        break;
+    default:
+        VECTOR_ORDER_LOOP(uint64_t, 8);
+        break;
+    }
+}
+
+/**
+ * @brief 按元素自身的数值对向量升序排序。
+ *
+ * @param this 指向要排序的向量结构体的指针。
+ * @param type 元素类型，其大小必须等于向量的valueSize。
+ * @note 使用LSD基数排序（稳定）：先把元素原地变换成可按无符号整数比较的键，一次读取统计出所有趟的直方图，跳过所有键在该位上相同的趟，
+ *       只分配一块与数据等大的临时缓冲区，排序后再变换回来。浮点数中-0.0排在0.0之前，NaN按符号位排在两端。
+ * @return bool 成功返回`true`；元素类型与向量不符或临时缓冲区分配失败时返回`false`，此时向量内容不变。
+ */
+bool VectorSort(Vector *this, VectorElemType type)
+{
+    if ((unsigned)type >= VECTOR_ELEM_TYPE_COUNT || vector_sort_elem_size[type] != this->valueSize)
+    {
+        fprintf(stderr, "VectorSort: element type does not match vector value size %zu.\n", this->valueSize);
+        return false;
+    }
+    size_t n = this->len;
+    if (n < 2)
+        return true;
+    void *scratch = NULL;
+    if (n >= VECTOR_RADIX_MIN && (scratch = malloc(n * this->valueSize)) == NULL)
+    {
+        fprintf(stderr, "Memory allocation failed for vector sort buffer.\n");
+        return false;
+    }
+    VectorOrderKeys(this->data, n, type, false);
+    switch (this->valueSize)
+    {
+    case 1:
+        vector_radix_u8((uint8_t *)this->data, (uint8_t *)scratch, n);
+        break;
+    case 2:
+        vector_radix_u16((uint16_t *)this->data, (uint16_t *)scratch, n);
+        break;
+    case 4:
+        vector_radix_u32((uint32_t *)this->data, (uint32_t *)scratch, n);
+        break;
+    default:
+        vector_radix_u64((uint64_t *)this->data, (uint64_t *)scratch, n);
+        break;
+    }
+    VectorOrderKeys(this->data, n, type, true);
+    free(scratch);
+    return true;
+}
+
+/**
+ * @brief 按key提取出的数值键对向量升序排序，适合按结构体中的某个字段排序。
+ *
+ * @param this 指向要排序的向量结构体的指针，元素可以是任意大小。
+ * @param keyType 键的类型，key按这个类型写入键。
+ * @param key 键提取函数，每个元素只调用一次。
+ * @note 先提取出（键，下标）对做LSD基数排序，再按下标把元素搬到正确位置；排序是稳定的，键相同的元素保持原有顺序。
+ * @return bool 成功返回`true`；keyType无效或内存分配失败时返回`false`，此时向量内容不变。
+ */
+bool VectorSortByKey(Vector *this, VectorElemType keyType, VectorKeyFn key)
+{
+    if ((unsigned)keyType >= VECTOR_ELEM_TYPE_COUNT)
+    {
+        fprintf(stderr, "VectorSortByKey: invalid key type.\n");
+        return false;
+    }
+    size_t n = this->len, valueSize = this->valueSize;
+    if (n < 2)
+        return true;
+    // 一次分配：两份（键，下标）数组，加上重排元素用的缓冲区
+    VectorKeyIndex *pairs = (VectorKeyIndex *)malloc(n * (2 * sizeof(VectorKeyIndex) + valueSize));
+    if (pairs == NULL)
+    {
+        fprintf(stderr, "Memory allocation failed for vector sort buffer.\n");
+        return false;
+    }
+    VectorKeyIndex *scratch = pairs + n;
+    char *elems = (char *)(scratch + n);
+    size_t bytes = vector_sort_elem_size[keyType];
+    for (size_t i = 0; i < n; ++i)
+    {
+        union
+        {
+            uint8_t u8;
+            uint16_t u16;
+            uint32_t u32;
+            uint64_t u64;
+        } k = {.u64 = 0};
+        key((char *)this->data + i * valueSize, &k);
+        uint64_t u = bytes == 1 ? k.u8 : bytes == 2 ? k.u16 : bytes == 4 ? k.u32 : k.u64;
+        pairs[i].key = vector_order_bits(u, keyType, bytes, false);
+        pairs[i].index = i;
+    }
+    vector_radix_pair(pairs, scratch, n);
+    for (size_t i = 0; i < n; ++i)
+        memcpy(elems + i * valueSize, (char *)this->data + pairs[i].index * valueSize, valueSize);
+    memcpy(this->data, elems, n * valueSize);
+    free(pairs);
+    return true;
+}
+
+/// 比较排序的上下文
+typedef struct VectorSorter
+{
+    char *base;
+    size_t size;
+    VectorCompareFn cmp;
+    char *tmp;   // 一个元素大小的临时空间，用于交换和插入
+    char *pivot; // 当前分区的主元副本
+} VectorSorter;
+
+#define VECTOR_ELEM(s, i) ((s)->base + (i) * (s)->size)
+
+static inline int vector_cmp(VectorSorter *s, size_t i, size_t j)
+{
+    return s->cmp(VECTOR_ELEM(s, i), VECTOR_ELEM(s, j));
+}
+
+/// @brief 复制一个元素；常见的元素大小用定长memcpy，编译器会把它变成一次寄存器读写
+static inline void vector_copy(VectorSorter *s, void *dst, const void *src)
+{
+    switch (s->size)
+    {
+    case 4:
+        memcpy(dst, src, 4);
+        break;
+    case 8:
+        memcpy(dst, src, 8);
+        break;
+    case 16:
+        memcpy(dst, src, 16);
+        break;
+    default:
+        memcpy(dst, src, s->size);
+        break;
+    }
+}
+
+static inline void vector_swap(VectorSorter *s, size_t i, size_t j)
+{
+    vector_copy(s, s->tmp, VECTOR_ELEM(s, i));
+    vector_copy(s, VECTOR_ELEM(s, i), VECTOR_ELEM(s, j));
+    vector_copy(s, VECTOR_ELEM(s, j), s->tmp);
+}
+
+/// @brief 对[lo, hi)做插入排序；limit不为0时移动的元素超过limit就放弃并返回false
+static bool vector_insertion_sort(VectorSorter *s, size_t lo, size_t hi, size_t limit)
+{
+    size_t moved = 0;
+    for (size_t i = lo + 1; i < hi; ++i)
+    {
+        if (vector_cmp(s, i, i - 1) >= 0)
+            continue;
+        vector_copy(s, s->tmp, VECTOR_ELEM(s, i));
+        size_t j = i;
+        do
+        {
+            vector_copy(s, VECTOR_ELEM(s, j), VECTOR_ELEM(s, j - 1));
+            --j;
+        } while (j > lo && s->cmp(s->tmp, VECTOR_ELEM(s, j - 1)) < 0);
+        vector_copy(s, VECTOR_ELEM(s, j), s->tmp);
+        moved += i - j;
+        if (limit != 0 && moved > limit)
+            return false;
+    }
+    return true;
+}
+
+static void vector_sift_down(VectorSorter *s, size_t lo, size_t root, size_t n)
+{
+    for (;;)
+    {
+        size_t child = 2 * root + 1;
+        if (child >= n)
+            break;
+        if (child + 1 < n && vector_cmp(s, lo + child, lo + child + 1) < 0)
+            ++child;
+        if (vector_cmp(s, lo + root, lo + child) >= 0)
+            break;
+        vector_swap(s, lo + root, lo + child);
+        root = child;
+    }
+}
+
+/// @brief 递归过深时的退路：对[lo, hi)做堆排序，保证O(n log n)
+static void vector_heap_sort(VectorSorter *s, size_t lo, size_t hi)
+{
+    size_t n = hi - lo;
+    for (size_t i = n / 2; i-- > 0;)
+        vector_sift_down(s, lo, i, n);
+    for (size_t i = n - 1; i > 0; --i)
+    {
+        vector_swap(s, lo, lo + i);
+        vector_sift_down(s, lo, 0, i);
+    }
+}
+
+/// @brief 把a、b、c三个位置排好序
+static void vector_sort3(VectorSorter *s, size_t a, size_t b, size_t c)
+{
+    if (vector_cmp(s, b, a) < 0)
+        vector_swap(s, a, b);
+    if (vector_cmp(s, c, b) < 0)
+    {
+        vector_swap(s, b, c);
+        if (vector_cmp(s, b, a) < 0)
+            vector_swap(s, a, b);
+    }
+}
+
+/// @brief 选主元并放到lo：短区间取三数中值，长区间取九数中值（ninther）
+static void vector_choose_pivot(VectorSorter *s, size_t lo, size_t hi)
+{
+    size_t n = hi - lo, mid = lo + n / 2;
+    if (n > 128)
+    {
+        size_t e = n / 8;
+        vector_sort3(s, lo, lo + e, lo + 2 * e);
+        vector_sort3(s, mid - e, mid, mid + e);
+        vector_sort3(s, hi - 1 - 2 * e, hi - 1 - e, hi - 1);
+        vector_sort3(s, lo + e, mid, hi - 1 - e);
+    }
+    else
+    {
+        vector_sort3(s, lo, mid, hi - 1);
+    }
+    vector_swap(s, lo, mid);
+}
+
+/// @brief 以lo处的元素为主元划分[lo, hi)，小于等于主元的在左、大于等于主元的在右，与主元相等的元素会被交换以保持两边平衡
+/// @return 主元的最终位置；*swapped为false表示区间原本就已划分好
+static size_t vector_partition(VectorSorter *s, size_t lo, size_t hi, bool *swapped)
+{
+    vector_copy(s, s->pivot, VECTOR_ELEM(s, lo));
+    size_t i = lo + 1, j = hi - 1;
+    *swapped = false;
+    for (;;)
+    {
+        while (i <= j && s->cmp(VECTOR_ELEM(s, i), s->pivot) < 0)
+            ++i;
+        while (i <= j && s->cmp(VECTOR_ELEM(s, j), s->pivot) > 0)
+            --j;
+        if (i >= j)
+            break;
+        vector_swap(s, i, j);
+        *swapped = true;
+        ++i;
+        --j;
+    }
+    vector_swap(s, lo, j);
+    return j;
+}
+
+/// @brief 把与主元相等的元素都放到左边，返回最后一个等于主元的位置；用于大量重复元素的情形
+static size_t vector_partition_equal(VectorSorter *s, size_t lo, size_t hi)
+{
+    vector_copy(s, s->pivot, VECTOR_ELEM(s, lo));
+    size_t store = lo;
+    for (size_t k = lo + 1; k < hi; ++k)
+        if (s->cmp(VECTOR_ELEM(s, k), s->pivot) <= 0)
+            vector_swap(s, ++store, k);
+    vector_swap(s, lo, store);
+    return store;
+}
+
+/// @brief pdqsort风格的内省排序：短区间插入排序；左邻元素不小于主元时先把相等元素整体跳过；
+///        分区没有发生交换时尝试有限步的插入排序；分区严重失衡时打乱几个元素并减少剩余深度，深度用完改用堆排序
+static void vector_intro_sort(VectorSorter *s, size_t lo, size_t hi, size_t depth, bool leftmost)
+{
+    while (hi - lo > VECTOR_INSERTION_THRESHOLD)
+    {
+        if (depth == 0)
+        {
+            vector_heap_sort(s, lo, hi);
+            return;
+        }
+        vector_choose_pivot(s, lo, hi);
+        if (!leftmost && vector_cmp(s, lo - 1, lo) >= 0)
+        {
+            // 前一个主元不小于当前主元，说明[lo, hi)中等于它的元素已经就位
+            lo = vector_partition_equal(s, lo, hi) + 1;
+            continue;
+        }
+        bool swapped;
+        size_t p = vector_partition(s, lo, hi, &swapped);
+        size_t left = p - lo, right = hi - p - 1, n = hi - lo;
+        if (left < n / 8 || right < n / 8)
+        {
+            --depth;
+            if (left >= VECTOR_INSERTION_THRESHOLD)
+            {
+                vector_swap(s, lo, lo + left / 4);
+                vector_swap(s, p - 1, p - left / 4);
+            }
+            if (right >= VECTOR_INSERTION_THRESHOLD)
+            {
+                vector_swap(s, p + 1, p + 1 + right / 4);
+                vector_swap(s, hi - 1, hi - right / 4);
+            }
+        }
+        else if (!swapped &&
+                 vector_insertion_sort(s, lo, p, VECTOR_PARTIAL_INSERTION_LIMIT) &&
+                 vector_insertion_sort(s, p + 1, hi, VECTOR_PARTIAL_INSERTION_LIMIT))
+        {
+            return;
+        }
+        // 递归处理较短的一侧，较长的一侧留在循环里，栈深度不超过O(log n)
+        if (left < right)
+        {
+            vector_intro_sort(s, lo, p, depth, leftmost);
+            lo = p + 1;
+            leftmost = false;
+        }
+        else
+        {
+            vector_intro_sort(s, p + 1, hi, depth, false);
+            hi = p;
+        }
+    }
+    vector_insertion_sort(s, lo, hi, 0);
+}
+
+/**
+ * @brief 用比较函数对向量升序排序，适用于无法提取数值键的元素。
+ *
+ * @param this 指向要排序的向量结构体的指针。
+ * @param cmp 比较函数，规则与qsort相同。
+ * @note pdqsort风格的内省排序，不稳定；最坏情况O(n log n)，对已排序、逆序和大量重复的输入接近线性。
+ *       数值键请优先使用VectorSort或VectorSortByKey，它们不需要逐次调用比较函数。
+ * @return bool 成功返回`true`；临时空间分配失败时返回`false`，此时向量内容不变。
+ */
+bool VectorSortCompare(Vector *this, VectorCompareFn cmp)
+{
+    size_t n = this->len;
+    if (n < 2)
+        return true;
+    char buffer[128];
+    VectorSorter s = {(char *)this->data, this->valueSize, cmp, buffer, buffer + 64};
+    if (this->valueSize > 64)
+    {
+        s.tmp = (char *)malloc(2 * this->valueSize);
+        if (s.tmp == NULL)
+        {
+            fprintf(stderr, "Memory allocation failed for vector sort buffer.\n");
+            return false;
+        }
+        s.pivot = s.tmp + this->valueSize;
+    }
+    size_t depth = 0;
+    for (size_t m = n; m > 1; m >>= 1)
+        ++depth;
+    vector_intro_sort(&s, 0, n, 2 * depth, true);
+    if (s.tmp != buffer)
+        free(s.tmp);
+    return true;
+}
\ No newline at end of file
@@ -0,0 +1,29 @@
+#ifndef __VECTOR_SORT_H__
+#define __VECTOR_SORT_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+
+#include "vector.h"
+#include "vector_simd.h"
+
+#define VECTOR_RADIX_MIN 64            // 元素少于这个数时基数排序退化为插入排序
+#define VECTOR_INSERTION_THRESHOLD 24  // 内省排序中小于这个长度的区间用插入排序
+#define VECTOR_PARTIAL_INSERTION_LIMIT 8 // 分区没有发生交换时，尝试插入排序最多允许移动的元素个数
+
+/// 比较函数，与qsort相同：a小于、等于、大于b时分别返回负数、0、正数
+typedef int (*VectorCompareFn)(const void *a, const void *b);
+
+/// 键提取函数：把元素value的键按keyType写入key
+typedef void (*VectorKeyFn)(const void *value, void *key);
+
+bool VectorSort(Vector *this, VectorElemType type);
+
+bool VectorSortByKey(Vector *this, VectorElemType keyType, VectorKeyFn key);
+
+bool VectorSortCompare(Vector *this, VectorCompareFn cmp);
+
+void VectorOrderKeys(void *data, size_t n, VectorElemType type, bool back);
+
+#endif
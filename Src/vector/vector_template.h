@@ -0,0 +1,215 @@
+#ifndef __VECTOR_TEMPLATE_H__
+#define __VECTOR_TEMPLATE_H__
+
+/**
+ * @file vector_template.h
+ * @brief 类型特化的向量：VECTOR_DEFINE(T, Name)生成结构体Name和一组static inline函数NameCreate、NamePushBack、NameAt等，
+ * 语义与Vector的同名函数相同，但元素类型在编译期已知，元素的复制就是普通的赋值，编译器可以内联并向量化遍历元素的循环。
+ *
+ * 用法示例：
+ * @code
+ * VECTOR_DEFINE(int, IntVector)
+ *
+ * IntVector v;
+ * IntVectorCreate(&v, 0);
+ * for (int i = 0; i < n; ++i)
+ *     IntVectorPushBack(&v, i);
+ * long long sum = 0;
+ * for (size_t i = 0; i < v.len; ++i) // 热循环里直接访问v.data
+ *     sum += v.data[i];
+ * IntVectorDelete(&v);
+ * @endcode
+ *
+ * 与Vector的区别：
+ * - NameAt与VectorGetValue一样检查下标并在越界时返回NULL；遍历时直接用data[i]可以省掉检查。
+ * - NameSetValue要求index小于容量（size），并把len更新为index + 1（若更大）。
+ * - NameCreate与VectorCreate一样把初始容量内的元素清零。
+ * - 扩容规则（growFactor、VECTOR_MIN_GROW_SIZE）与Vector完全相同。
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stddef.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "vector.h"
+
+#define VECTOR_DEFINE(T, Name)                                                                    \
+    typedef struct Name                                                                           \
+    {                                                                                             \
+        size_t size, len;                                                                         \
+        T *data;                                                                                  \
+        double growFactor;                                                                        \
+    } Name;                                                                                       \
+                                                                                                  \
+    static inline bool Name##Create(Name *this, size_t size)                                      \
+    {                                                                                             \
+        this->size = size;                                                                        \
+        this->len = 0;                                                                            \
+        this->growFactor = VECTOR_DEFAULT_GROW_FACTOR;                                            \
+        this->data = size > 0 ? (T *)calloc(size, sizeof(T)) : NULL;                              \
+        if (this->data == NULL && size > 0)                                                       \
+        {                                                                                         \
+            fprintf(stderr, "Memory allocation failed for vector data.\n");                       \
+            this->size = 0;                                                                       \
+            return false;                                                                         \
+        }                                                                                         \
+        return true;                                                                              \
+    }                                                                                             \
+                                                                                                  \
+    static inline void Name##Delete(Name *this)                                                   \
+    {                                                                                             \
+        free(this->data);                                                                         \
+        this->data = NULL;                                                                        \
+        this->size = 0;                                                                           \
+        this->len = 0;                                                                            \
+    }                                                                                             \
+                                                                                                  \
+    static inline bool Name##Resize(Name *this, size_t newSize)                                   \
+    {                                                                                             \
+        if (newSize > SIZE_MAX / sizeof(T))                                                       \
+        {                                                                                         \
+            fprintf(stderr, "Memory reallocation failed.\n");                                     \
+            return false;                                                                         \
+        }                                                                                         \
+        T *newData = (T *)realloc(this->data, newSize * sizeof(T));                               \
+        if (newData == NULL && newSize > 0)                                                       \
+        {                                                                                         \
+            fprintf(stderr, "Memory reallocation failed.\n");                                     \
+            return false;                                                                         \
+        }                                                                                         \
+        this->data = newData;                                                                     \
+        this->size = newSize;                                                                     \
+        return true;                                                                              \
+    }                                                                                             \
+                                                                                                  \
+    static inline bool Name##Grow(Name *this, size_t minSize)                                     \
+    {                                                                                             \
+        if (minSize <= this->size)                                                                \
+            return true;                                                                          \
+        double factor = this->growFactor > 1.0 ? this->growFactor : VECTOR_DEFAULT_GROW_FACTOR;   \
+        double scaled = (double)this->size * factor;                                              \
+        size_t newSize = scaled < (double)SIZE_MAX ? (size_t)scaled : SIZE_MAX;                   \
+        if (newSize < VECTOR_MIN_GROW_SIZE)                                                       \
+            newSize = VECTOR_MIN_GROW_SIZE;                                                       \
+        if (newSize < minSize)                                                                    \
+            newSize = minSize;                                                                    \
+        return Name##Resize(this, newSize);                                                       \
+    }                                                                                             \
+                                                                                                  \
+    static inline void Name##SetGrowFactor(Name *this, double growFactor)                         \
+    {                                                                                             \
+        this->growFactor = growFactor > 1.0 ? growFactor : VECTOR_DEFAULT_GROW_FACTOR;            \
+    }                                                                                             \
+                                                                                                  \
+    static inline bool Name##Reserve(Name *this, size_t size)                                     \
+    {                                                                                             \
+        return size <= this->size || Name##Resize(this, size);                                    \
+    }                                                                                             \
+                                                                                                  \
+    static inline bool Name##ShrinkToFit(Name *this)                                              \
+    {                                                                                             \
+        if (this->len == this->size)                                                              \
+            return true;                                                                          \
+        if (this->len == 0)                                                                       \
+        {                                                                                         \
+            Name##Delete(this);                                                                   \
+            return true;                                                                          \
+        }                                                                                         \
+        return Name##Resize(this, this->len);                                                     \
+    }                                                                                             \
+                                                                                                  \
+    static inline bool Name##PushBack(Name *this, T value)                                        \
+    {                                                                                             \
+        if (__builtin_expect(this->len == this->size, 0) && !Name##Grow(this, this->len + 1))     \
+            return false;                                                                         \
+        this->data[this->len++] = value;                                                          \
+        return true;                                                                              \
+    }                                                                                             \
+                                                                                                  \
+    static inline bool Name##SetValue(Name *this, size_t index, T value)                          \
+    {                                                                                             \
+        if (index >= this->size)                                                                  \
+        {                                                                                         \
+            fprintf(stderr, "Error: Index out of bounds in " #Name "SetValue.\n");                \
+            return false;                                                                         \
+        }                                                                                         \
+        if (index >= this->len)                                                                   \
+            this->len = index + 1;                                                                \
+        this->data[index] = value;                                                                \
+        return true;                                                                              \
+    }                                                                                             \
+                                                                                                  \
+    static inline T *Name##At(Name *this, size_t index)                                           \
+    {                                                                                             \
+        if (index >= this->len)                                                                   \
+        {                                                                                         \
+            fprintf(stderr, "Error: Index out of bounds in " #Name "At.\n");                      \
+            return NULL;                                                                          \
+        }                                                                                         \
+        return &this->data[index];                                                                \
+    }                                                                                             \
+                                                                                                  \
+    static inline bool Name##AppendN(Name *this, const T *values, size_t n)                       \
+    {                                                                                             \
+        if (n > SIZE_MAX - this->len || !Name##Grow(this, this->len + n))                         \
+            return false;                                                                         \
+        memcpy(this->data + this->len, values, n * sizeof(T));                                    \
+        this->len += n;                                                                           \
+        return true;                                                                              \
+    }                                                                                             \
+                                                                                                  \
+    static inline bool Name##InsertRange(Name *this, size_t index, const T *values, size_t n)     \
+    {                                                                                             \
+        if (index > this->len)                                                                    \
+        {                                                                                         \
+            fprintf(stderr, "Error: Index out of bounds in " #Name "InsertRange.\n");             \
+            return false;                                                                         \
+        }                                                                                         \
+        if (n > SIZE_MAX - this->len || !Name##Grow(this, this->len + n))                         \
+            return false;                                                                         \
+        memmove(this->data + index + n, this->data + index, (this->len - index) * sizeof(T));     \
+        memcpy(this->data + index, values, n * sizeof(T));                                        \
+        this->len += n;                                                                           \
+        return true;                                                                              \
+    }                                                                                             \
+                                                                                                  \
+    static inline bool Name##EraseRange(Name *this, size_t index, size_t n)                       \
+    {                                                                                             \
+        if (n > this->len || index > this->len - n)                                               \
+        {                                                                                         \
+            fprintf(stderr, "Error: Range out of bounds in " #Name "EraseRange.\n");              \
+            return false;                                                                         \
+        }                                                                                         \
+        size_t tail = this->len - index - n;                                                      \
+        memmove(this->data + index, this->data + index + n, tail * sizeof(T));                    \
+        this->len -= n;                                                                           \
+        return true;                                                                              \
+    }                                                                                             \
+                                                                                                  \
+    static inline bool Name##IsFull(const Name *this)                                             \
+    {                                                                                             \
+        return this->len == this->size;                                                           \
+    }                                                                                             \
+                                                                                                  \
+    static inline bool Name##IsEmpty(const Name *this)                                            \
+    {                                                                                             \
+        return this->len == 0;                                                                    \
+    }                                                                                             \
+                                                                                                  \
+    static inline size_t Name##Size(const Name *this)                                             \
+    {                                                                                             \
+        return this->size;                                                                        \
+    }                                                                                             \
+                                                                                                  \
+    static inline size_t Name##Len(const Name *this)                                              \
+    {                                                                                             \
+        return this->len;                                                                         \
+    }
+
+VECTOR_DEFINE(int, IntVector)
+VECTOR_DEFINE(double, DoubleVector)
+
+#endif